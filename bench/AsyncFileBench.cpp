@@ -0,0 +1,85 @@
+#include "Bench.h"
+#include "FileSystem/AsyncFileQueue.h"
+#include "FileSystem/FileSystem.h"
+
+#include <filesystem>
+#include <format>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t SMALL_FILE_SIZE = 4096;
+
+    //~ Submits every file as one batch, the queue keeps QueueDepth of them in flight
+    double ReadAll(const ASYNC_FILE_QUEUE_DESC& desc, const std::vector<std::string>& paths, std::vector<char>& buffer,
+                   uint64_t& failed, bool& usedPort)
+    {
+        AsyncFileQueue queue{ desc };
+        usedPort = queue.IsUsingCompletionPort();
+
+        return Bench::MeasureSeconds([&]
+        {
+            std::vector<FILE_READ_REQUEST> batch(paths.size());
+            for (size_t i = 0; i < paths.size(); ++i)
+            {
+                batch[i].Path        = paths[i];
+                batch[i].Length      = SMALL_FILE_SIZE;
+                batch[i].Destination = buffer.data() + i * SMALL_FILE_SIZE;
+            }
+
+            for (std::future<FILE_READ_RESULT>& result : queue.Submit(std::move(batch)))
+                if (!result.get().Succeeded()) ++failed;
+        });
+    }
+}
+
+//~ 10k 4 KB files through AsyncFileQueue at queue depth 1 and 64, against one ReadFromFile after another.
+//~ The files were just written, so this is per-request overhead on a warm cache more than disk latency
+FOX_BENCH(AsyncFileSmallReads)
+{
+    const uint64_t files = context.Scale(10'000);
+    const std::filesystem::path root = "bench_small_files";
+
+    std::filesystem::create_directories(root);
+    std::vector<std::string> paths;
+    paths.reserve(files);
+
+    const std::vector<char> contents(SMALL_FILE_SIZE, 'x');
+    for (uint64_t i = 0; i < files; ++i)
+    {
+        paths.push_back((root / std::format("{:05}.bin", i)).string());
+
+        FileSystem file;
+        if (!file.OpenForWrite(paths.back()) || !file.WriteBytes(contents.data(), contents.size()))
+        {
+            context.Note(std::format("could not write {}, skipped", paths.back()));
+            std::filesystem::remove_all(root);
+            return;
+        }
+        file.Close();
+    }
+
+    uint64_t checksum = 0;
+    const double serial = Bench::MeasureSeconds([&]
+    {
+        for (const std::string& path : paths) checksum += FileSystem::ReadFromFile(path).size();
+    });
+    Bench::Escape(&checksum);
+    context.Report("ReadFromFile, one at a time", files, serial);
+
+    std::vector<char> buffer(files * SMALL_FILE_SIZE);
+    for (const uint32_t depth : { 1u, 64u })
+    {
+        ASYNC_FILE_QUEUE_DESC desc{};
+        desc.QueueDepth = depth;
+
+        uint64_t failed   = 0;
+        bool     usedPort = false;
+        const double seconds = ReadAll(desc, paths, buffer, failed, usedPort);
+        context.Report(std::format("AsyncFileQueue, depth {:>2}", depth), files, seconds,
+            std::format("{}, {:.1f}x, {} failed", usedPort ? "completion port" : "fallback threads", serial / seconds, failed));
+    }
+    Bench::Escape(buffer.data());
+
+    std::filesystem::remove_all(root);
+}
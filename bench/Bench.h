@@ -0,0 +1,66 @@
+//
+// fox-bench: one executable for every microbenchmark in the tree.
+// usage: fox-bench [filter] [--quick] [--list]
+//
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Bench
+{
+    /**
+     * @brief Handed to every case. Report prints one aligned row per measured variant,
+     *        Scale shrinks iteration counts under --quick so a smoke run stays in seconds.
+     */
+    class Context
+    {
+    public:
+        explicit Context(const bool quick) : m_bQuick(quick) {}
+
+        void Report(std::string_view label, uint64_t operations, double seconds, std::string_view note = {}) const;
+        void Note(std::string_view text) const;
+
+        [[nodiscard]] uint64_t Scale(const uint64_t iterations) const
+        {
+            return m_bQuick ? (iterations / 10 > 0 ? iterations / 10 : 1) : iterations;
+        }
+
+        [[nodiscard]] bool IsQuick() const { return m_bQuick; }
+
+    private:
+        bool m_bQuick{ false };
+    };
+
+    using BenchFunction = void(*)(Context&);
+
+    //~ Soaks only run when the filter names them, a plain fox-bench stays short
+    bool Register(std::string_view name, BenchFunction function, bool soak = false);
+
+    template<typename Fn>
+    double MeasureSeconds(Fn&& fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    //~ Keeps a result alive without the optimiser proving it unused
+    void Escape(const void* pointer);
+}
+
+#define FOX_BENCH(NAME)                                                             \
+    static void NAME(Bench::Context& context);                                      \
+    static const bool NAME##_registered = Bench::Register(#NAME, &NAME);            \
+    static void NAME(Bench::Context& context)
+
+#define FOX_BENCH_SOAK(NAME)                                                        \
+    static void NAME(Bench::Context& context);                                      \
+    static const bool NAME##_registered = Bench::Register(#NAME, &NAME, true);      \
+    static void NAME(Bench::Context& context)
+
+#endif //BENCH_H
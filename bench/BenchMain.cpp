@@ -0,0 +1,81 @@
+#include "Bench.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    struct BENCH_CASE
+    {
+        std::string_view     Name;
+        Bench::BenchFunction Function;
+        bool                 Soak;
+    };
+
+    //~ Function local so registration from other translation units never sees it unconstructed
+    std::vector<BENCH_CASE>& Cases()
+    {
+        static std::vector<BENCH_CASE> cases;
+        return cases;
+    }
+
+    volatile const void* g_pEscapeSink{ nullptr };
+}
+
+bool Bench::Register(const std::string_view name, const BenchFunction function, const bool soak)
+{
+    Cases().push_back({ name, function, soak });
+    return true;
+}
+
+void Bench::Escape(const void* pointer)
+{
+    g_pEscapeSink = pointer;
+}
+
+void Bench::Context::Report(const std::string_view label, const uint64_t operations, const double seconds,
+                            const std::string_view note) const
+{
+    const double ns     = operations > 0 ? seconds * 1e9 / static_cast<double>(operations) : 0.0;
+    const double perSec = seconds > 0.0 ? static_cast<double>(operations) / seconds : 0.0;
+    std::printf("  %-44.*s %12.2f ns/op %14.0f op/s  %.*s\n",
+        static_cast<int>(label.size()), label.data(), ns, perSec, static_cast<int>(note.size()), note.data());
+    std::fflush(stdout);
+}
+
+void Bench::Context::Note(const std::string_view text) const
+{
+    std::printf("  %.*s\n", static_cast<int>(text.size()), text.data());
+    std::fflush(stdout);
+}
+
+int main(int argc, char** argv)
+{
+    std::string_view filter;
+    bool quick = false;
+    bool list  = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        if      (arg == "--quick") quick = true;
+        else if (arg == "--list")  list  = true;
+        else                       filter = arg;
+    }
+
+    Bench::Context context{ quick };
+    for (const BENCH_CASE& bench : Cases())
+    {
+        if (!filter.empty() && bench.Name.find(filter) == std::string_view::npos) continue;
+        std::printf("%.*s%s\n", static_cast<int>(bench.Name.size()), bench.Name.data(), bench.Soak ? " (soak)" : "");
+        if (list) continue;
+        if (bench.Soak && filter.empty())
+        {
+            context.Note("skipped, run it by name");
+            continue;
+        }
+        bench.Function(context);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+#include "Bench.h"
+#include "FileSystem/BinaryReader.h"
+#include "FileSystem/BinaryWriter.h"
+#include "FileSystem/FileSystem.h"
+
+#include <filesystem>
+#include <format>
+
+namespace
+{
+    //~ A typical save-game style record: a few fixed fields and a short name
+    typedef struct BENCH_RECORD
+    {
+        uint32_t Id;
+        float    Position[3];
+        uint64_t Timestamp;
+    } BENCH_RECORD;
+
+    BENCH_RECORD MakeRecord(const uint64_t i)
+    {
+        return { static_cast<uint32_t>(i), { static_cast<float>(i), 1.0f, 2.0f }, i * 16 };
+    }
+
+    uint64_t SizeOf(const std::string& path)
+    {
+        return std::filesystem::exists(path) ? std::filesystem::file_size(path) : 0;
+    }
+}
+
+//~ The same record stream through FileSystem (one WriteFile/ReadFile per field, what callers did before)
+//~ and through the buffered BinaryWriter/BinaryReader
+FOX_BENCH(BinaryIoRecords)
+{
+    const uint64_t records = context.Scale(1'000'000);
+    const std::string rawPath      = "bench_records_raw.bin";
+    const std::string bufferedPath = "bench_records_buffered.bin";
+    const std::string recordName   = "entity";
+
+    const double rawWrite = Bench::MeasureSeconds([&]
+    {
+        FileSystem file;
+        if (!file.OpenForWrite(rawPath)) return;
+        for (uint64_t i = 0; i < records; ++i)
+        {
+            const BENCH_RECORD record = MakeRecord(i);
+            file.WriteBytes(&record, sizeof(record));
+            file.WriteString(recordName);
+        }
+        file.Close();
+    });
+    context.Report("FileSystem write", records, rawWrite, std::format("{} bytes", SizeOf(rawPath)));
+
+    const double bufferedWrite = Bench::MeasureSeconds([&]
+    {
+        BinaryWriter writer;
+        if (!writer.Open(bufferedPath)) return;
+        for (uint64_t i = 0; i < records; ++i)
+        {
+            writer.Write(MakeRecord(i));
+            writer.WriteString(recordName);
+        }
+        writer.Close();
+    });
+    context.Report("BinaryWriter", records, bufferedWrite,
+        std::format("{} bytes, {:.1f}x", SizeOf(bufferedPath), rawWrite / bufferedWrite));
+
+    uint64_t checksum = 0;
+    const double rawRead = Bench::MeasureSeconds([&]
+    {
+        FileSystem file;
+        if (!file.OpenForRead(rawPath)) return;
+        BENCH_RECORD record{};
+        std::string  name;
+        while (file.ReadBytes(&record, sizeof(record)) && file.ReadString(name)) checksum += record.Timestamp + name.size();
+        file.Close();
+    });
+    context.Report("FileSystem read", records, rawRead);
+
+    const double bufferedRead = Bench::MeasureSeconds([&]
+    {
+        BinaryReader reader;
+        if (!reader.Open(bufferedPath)) return;
+        BENCH_RECORD     record{};
+        std::string_view name;
+        while (reader.Read(record) && reader.ReadStringView(name)) checksum += record.Timestamp + name.size();
+        reader.Close();
+    });
+    context.Report("BinaryReader", records, bufferedRead, std::format("{:.1f}x", rawRead / bufferedRead));
+
+    Bench::Escape(&checksum);
+    std::filesystem::remove(rawPath);
+    std::filesystem::remove(bufferedPath);
+}
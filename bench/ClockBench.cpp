@@ -0,0 +1,59 @@
+#include "Bench.h"
+#include "Timer/FastClock.h"
+
+#include <format>
+#include <thread>
+
+namespace
+{
+    //~ Back-to-back reads, the sum keeps the loop from being folded away
+    template<typename ReadFn>
+    void RunReads(Bench::Context& context, const std::string_view label, const uint64_t reads, ReadFn&& read)
+    {
+        uint64_t sum = 0;
+        const double seconds = Bench::MeasureSeconds([&]
+        {
+            for (uint64_t i = 0; i < reads; ++i) sum += read();
+        });
+        Bench::Escape(&sum);
+        context.Report(label, reads, seconds);
+    }
+}
+
+FOX_BENCH(FastClockRead)
+{
+    FastClock::Calibrate();
+    context.Note(std::format("{} at {} Hz", FastClock::IsTscInvariant() ? "invariant TSC" : "QPC", FastClock::GetFrequency()));
+
+    const uint64_t reads = context.Scale(10'000'000);
+    RunReads(context, "FastClock::Now",        reads, [] { return FastClock::Now(); });
+    RunReads(context, "FastClock::NowOrdered", reads, [] { return FastClock::NowOrdered(); });
+    RunReads(context, "QueryPerformanceCounter", reads, []
+    {
+        LARGE_INTEGER ticks;
+        QueryPerformanceCounter(&ticks);
+        return static_cast<uint64_t>(ticks.QuadPart);
+    });
+    RunReads(context, "steady_clock::now", reads, []
+    {
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    });
+}
+
+//~ Ten minutes (five seconds under --quick) of the calibrated TSC against QPC, one row per tenth
+FOX_BENCH_SOAK(FastClockDrift)
+{
+    FastClock::Calibrate();
+    if (!FastClock::IsTscInvariant())
+    {
+        context.Note("no invariant TSC, FastClock is QPC and cannot drift from it");
+        return;
+    }
+
+    const std::chrono::duration<double> step(context.IsQuick() ? 0.5 : 60.0);
+    for (int checkpoint = 1; checkpoint <= 10; ++checkpoint)
+    {
+        std::this_thread::sleep_for(step);
+        context.Note(std::format("after {:>5.1f} s: {:+.3f} ppm", step.count() * checkpoint, FastClock::GetDriftPpm()));
+    }
+}
@@ -0,0 +1,124 @@
+#include "Bench.h"
+#include "Engine/Coroutines/Task.h"
+#include "Engine/JobSystem/JobSystem.h"
+
+#include <atomic>
+#include <format>
+#include <thread>
+
+// CoroutineScheduler pulls in Vulkan for its fence awaiter, so these cases drive Task, the frame pool
+// and the JobSystem hop it is built from directly. The worker hop below is ResumeOnWorkerThread verbatim.
+
+namespace
+{
+    //~ Eager, self-destroying driver, the same shape as the scheduler's Spawn
+    struct BENCH_DRIVER
+    {
+        struct promise_type
+        {
+            static void* operator new(const size_t size) { return CoroutineFramePool::Allocate(size); }
+            static void  operator delete(void* pFrame, const size_t size) noexcept { CoroutineFramePool::Free(pFrame, size); }
+
+            BENCH_DRIVER        get_return_object  () const noexcept { return {}; }
+            std::suspend_never  initial_suspend    () const noexcept { return {}; }
+            std::suspend_never  final_suspend      () const noexcept { return {}; }
+            void                return_void        () const noexcept {}
+            void                unhandled_exception() const noexcept { std::terminate(); }
+        };
+    };
+
+    //~ Suspends and hands the handle to whoever resumes it next
+    struct PARK_AWAITER
+    {
+        std::coroutine_handle<>* pSlot;
+
+        bool await_ready  () const noexcept { return false; }
+        void await_suspend(const std::coroutine_handle<> handle) const noexcept { *pSlot = handle; }
+        void await_resume () const noexcept {}
+    };
+
+    struct WORKER_HOP
+    {
+        JobSystem* pJobs;
+
+        bool await_ready  () const noexcept { return false; }
+        void await_suspend(const std::coroutine_handle<> handle) const
+        {
+            pJobs->PostToWorker([](void* address) { std::coroutine_handle<>::from_address(address).resume(); }, handle.address());
+        }
+        void await_resume () const noexcept {}
+    };
+
+    Task<void> ParkLoop(std::coroutine_handle<>* pSlot, const uint64_t suspends)
+    {
+        for (uint64_t i = 0; i < suspends; ++i) co_await PARK_AWAITER{ pSlot };
+    }
+
+    Task<uint64_t> Leaf(const uint64_t value)
+    {
+        co_return value + 1;
+    }
+
+    Task<void> AwaitChildren(const uint64_t children, uint64_t& sum)
+    {
+        for (uint64_t i = 0; i < children; ++i) sum += co_await Leaf(i);
+    }
+
+    Task<void> HopLoop(JobSystem& jobs, const uint64_t hops)
+    {
+        for (uint64_t i = 0; i < hops; ++i) co_await WORKER_HOP{ &jobs };
+    }
+
+    BENCH_DRIVER Drive(Task<void> task, std::atomic<bool>& done)
+    {
+        co_await std::move(task);
+        done.store(true, std::memory_order_release);
+    }
+}
+
+//~ Raw suspend + resume through a Task, creating and awaiting a child Task (pooled frame), and a worker hop
+FOX_BENCH(CoroutineSuspendResume)
+{
+    {
+        const uint64_t suspends = context.Scale(10'000'000);
+        std::coroutine_handle<> parked;
+        std::atomic<bool>       done{ false };
+
+        const double seconds = Bench::MeasureSeconds([&]
+        {
+            Drive(ParkLoop(&parked, suspends), done);
+            while (!done.load(std::memory_order_relaxed)) parked.resume();
+        });
+        context.Report("suspend + resume", suspends, seconds);
+    }
+
+    {
+        const uint64_t children = context.Scale(10'000'000);
+        const uint64_t heapBefore   = CoroutineFramePool::GetHeapAllocations();
+        const uint64_t pooledBefore = CoroutineFramePool::GetPooledAllocations();
+
+        uint64_t          sum = 0;
+        std::atomic<bool> done{ false };
+        const double seconds = Bench::MeasureSeconds([&] { Drive(AwaitChildren(children, sum), done); });
+        Bench::Escape(&sum);
+
+        context.Report("co_await child Task", children, seconds,
+            std::format("{} heap / {} pooled frame allocations",
+                CoroutineFramePool::GetHeapAllocations() - heapBefore, CoroutineFramePool::GetPooledAllocations() - pooledBefore));
+    }
+
+    {
+        JOB_SYSTEM_DESC desc{};
+        desc.WorkerCount = 1;
+        JobSystem jobs{ desc };
+
+        const uint64_t hops = context.Scale(1'000'000);
+        std::atomic<bool> done{ false };
+        const double seconds = Bench::MeasureSeconds([&]
+        {
+            Drive(HopLoop(jobs, hops), done);
+            while (!done.load(std::memory_order_acquire)) std::this_thread::yield();
+        });
+        context.Report("worker hop (PostToWorker)", hops, seconds);
+    }
+}
@@ -0,0 +1,87 @@
+#include "Bench.h"
+#include "FileSystem/FileSystem.h"
+#include "FileSystem/MappedFile.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <vector>
+
+namespace
+{
+    constexpr uint64_t MB        = 1024 * 1024;
+    constexpr size_t   PAGE_SIZE = 4096;
+
+    //~ Written in 1 MB chunks so the 5 GB file never needs 5 GB of RAM to create
+    bool WriteTestFile(const std::string& path, const uint64_t size)
+    {
+        std::vector<char> chunk(MB);
+        for (size_t i = 0; i < chunk.size(); ++i) chunk[i] = static_cast<char>(i * 31);
+
+        FileSystem file;
+        if (!file.OpenForWrite(path)) return false;
+        for (uint64_t written = 0; written < size; written += chunk.size())
+            if (!file.WriteBytes(chunk.data(), static_cast<size_t>(std::min<uint64_t>(chunk.size(), size - written)))) return false;
+        file.Close();
+        return true;
+    }
+
+    //~ Touches one byte per page, a mapped view costs nothing until its pages are faulted in
+    template<typename Byte>
+    uint64_t TouchPages(const Byte* data, const size_t size)
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < size; i += PAGE_SIZE) sum += static_cast<uint8_t>(data[i]);
+        return sum;
+    }
+
+    //~ Both paths on a warm cache, the file was just written: this is the copy and the allocation, not the disk
+    void CompareReads(Bench::Context& context, const uint64_t size, const uint64_t repeats)
+    {
+        const std::string path = std::format("bench_read_{}mb.bin", size / MB);
+        if (!WriteTestFile(path, size))
+        {
+            context.Note(std::format("could not write {}, skipped", path));
+            return;
+        }
+
+        uint64_t sum = 0;
+        const double copied = Bench::MeasureSeconds([&]
+        {
+            for (uint64_t i = 0; i < repeats; ++i)
+            {
+                const std::vector<char> bytes = FileSystem::ReadFromFile(path);
+                sum += TouchPages(bytes.data(), bytes.size());
+            }
+        });
+        context.Report(std::format("ReadFromFile, {:>4} MB", size / MB), repeats, copied,
+            std::format("{:.2f} GB/s", static_cast<double>(size * repeats) / copied / 1e9));
+
+        const double mapped = Bench::MeasureSeconds([&]
+        {
+            for (uint64_t i = 0; i < repeats; ++i)
+            {
+                const MappedFile view = FileSystem::MapFile(path, FileAccessHint::Sequential);
+                sum += TouchPages(view.Data(), view.Size());
+            }
+        });
+        context.Report(std::format("MapFile,      {:>4} MB", size / MB), repeats, mapped,
+            std::format("{:.2f} GB/s, {:.1f}x", static_cast<double>(size * repeats) / mapped / 1e9, copied / mapped));
+
+        Bench::Escape(&sum);
+        std::filesystem::remove(path);
+    }
+}
+
+//~ Whole-file loading against the zero-copy mapped view, every page touched once per load
+FOX_BENCH(FileReadMapped)
+{
+    CompareReads(context, 1 * MB,   context.Scale(1'000));
+    CompareReads(context, 100 * MB, context.Scale(20));
+}
+
+//~ Past 4 GB, where ReadFromFile needs several ReadFile calls and a 5 GB allocation. Needs ~5 GB of disk
+FOX_BENCH_SOAK(FileReadMapped5GB)
+{
+    CompareReads(context, 5 * 1024 * MB, 1);
+}
@@ -0,0 +1,95 @@
+#include "Bench.h"
+#include "FileSystem/FileSystem.h"
+
+#include <filesystem>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t TOP_DIRECTORIES = 20;
+    constexpr uint32_t SUB_DIRECTORIES = 10; // per top directory, files live in these
+
+    //~ What the tools each wrote before Scan: FindFirstFile recursion, one entry per call, one thread
+    void WalkSerial(const std::string& directory, std::vector<FILE_SCAN_ENTRY>& files)
+    {
+        WIN32_FIND_DATA data{};
+        HANDLE find = FindFirstFile((directory + "\\*").c_str(), &data);
+        if (find == INVALID_HANDLE_VALUE) return;
+
+        do
+        {
+            const char* name = data.cFileName;
+            if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) continue;
+
+            std::string path = directory + '\\' + name;
+            if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            {
+                WalkSerial(path, files);
+                continue;
+            }
+            files.push_back({
+                std::move(path),
+                (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow,
+                (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime
+            });
+        } while (FindNextFile(find, &data));
+
+        FindClose(find);
+    }
+
+    //~ 20 x 10 directories of empty files, returns how many files were created
+    uint64_t BuildTree(const std::string& root, const uint32_t filesPerDirectory)
+    {
+        uint64_t created = 0;
+        for (uint32_t top = 0; top < TOP_DIRECTORIES; ++top)
+        {
+            for (uint32_t sub = 0; sub < SUB_DIRECTORIES; ++sub)
+            {
+                const std::string directory = std::format("{}\\{:02}\\{:02}", root, top, sub);
+                if (!FileSystem::CreateDirectories(directory)) return created;
+
+                for (uint32_t i = 0; i < filesPerDirectory; ++i)
+                {
+                    FileSystem file;
+                    if (!file.OpenForWrite(std::format("{}\\asset_{:04}.bin", directory, i))) return created;
+                    file.Close();
+                    ++created;
+                }
+            }
+        }
+        return created;
+    }
+}
+
+//~ FileSystem::Scan over a generated 200k-file tree (20k under --quick) against a serial FindFirstFile walk.
+//~ Creating the tree takes minutes and the cache is warm after it, so this is a soak and it times enumeration, not the disk
+FOX_BENCH_SOAK(FileSystemScan)
+{
+    const std::string root = "bench_scan_tree";
+    const uint32_t filesPerDirectory = context.IsQuick() ? 100 : 1'000;
+
+    const uint64_t files = BuildTree(root, filesPerDirectory);
+    if (files != uint64_t{ TOP_DIRECTORIES } * SUB_DIRECTORIES * filesPerDirectory)
+    {
+        context.Note(std::format("could not build the tree under {} ({} files), skipped", root, files));
+        std::filesystem::remove_all(root);
+        return;
+    }
+
+    std::vector<FILE_SCAN_ENTRY> walked;
+    walked.reserve(files);
+    const double serial = Bench::MeasureSeconds([&] { WalkSerial(root, walked); });
+    context.Report("serial FindFirstFile walk", files, serial, std::format("{} entries", walked.size()));
+
+    for (const uint32_t threads : { 1u, 0u })
+    {
+        std::vector<FILE_SCAN_ENTRY> scanned;
+        const double seconds = Bench::MeasureSeconds([&] { scanned = FileSystem::Scan(root, {}, threads); });
+        context.Report(threads ? "FileSystem::Scan, 1 thread" : "FileSystem::Scan, default threads", files, seconds,
+            std::format("{} entries, {:.1f}x", scanned.size(), serial / seconds));
+    }
+
+    std::filesystem::remove_all(root);
+}
@@ -0,0 +1,140 @@
+#include "Bench.h"
+#include "Engine/JobSystem/JobSystem.h"
+
+#include <condition_variable>
+#include <deque>
+#include <format>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //~ The tiny job: a few instructions, so the numbers are scheduling overhead and nothing else
+    FORCELINE void TinyWork(std::atomic<uint64_t>& sum, const uint64_t i)
+    {
+        sum.fetch_add(i & 7, std::memory_order_relaxed);
+    }
+
+    //~ What the engine would have written without a job system: one locked deque, workers on a condition variable
+    class MutexQueue
+    {
+    public:
+        explicit MutexQueue(const uint32_t workers)
+        {
+            for (uint32_t i = 0; i < workers; ++i) m_workers.emplace_back([this] { WorkerLoop(); });
+        }
+
+        ~MutexQueue()
+        {
+            {
+                std::scoped_lock lock(m_mutex);
+                m_bStop = true;
+            }
+            m_ready.notify_all();
+        }
+
+        void Push(std::function<void()> job)
+        {
+            {
+                std::scoped_lock lock(m_mutex);
+                m_jobs.push_back(std::move(job));
+            }
+            m_ready.notify_one();
+        }
+
+    private:
+        void WorkerLoop()
+        {
+            while (true)
+            {
+                std::function<void()> job;
+                {
+                    std::unique_lock lock(m_mutex);
+                    m_ready.wait(lock, [this] { return m_bStop || !m_jobs.empty(); });
+                    if (m_jobs.empty()) return;
+
+                    job = std::move(m_jobs.front());
+                    m_jobs.pop_front();
+                }
+                job();
+            }
+        }
+
+    private:
+        std::mutex                        m_mutex;
+        std::condition_variable           m_ready;
+        std::deque<std::function<void()>> m_jobs;
+        bool                              m_bStop{ false };
+        std::vector<std::jthread>         m_workers; // last, joined before the queue goes away
+    };
+}
+
+//~ 1M tiny jobs through the job system (one child job each, and as one ParallelFor),
+//~ a mutex + condition variable queue, and std::async
+FOX_BENCH(JobSystemTinyJobs)
+{
+    const uint64_t jobs    = context.Scale(1'000'000);
+    const uint32_t workers = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    context.Note(std::format("{} worker(s) plus the calling thread", workers));
+
+    std::atomic<uint64_t> sum{ 0 };
+    {
+        JOB_SYSTEM_DESC desc{};
+        desc.WorkerCount = workers;
+        JobSystem system{ desc };
+
+        // children outnumber the per-thread ring, the creator helps drain it as it wraps
+        const double seconds = Bench::MeasureSeconds([&]
+        {
+            JOB* root = system.CreateJob([] {});
+            for (uint64_t i = 0; i < jobs; ++i)
+                system.Run(system.CreateChildJob(root, [&sum, i] { TinyWork(sum, i); }));
+            system.Run(root);
+            system.Wait(root);
+        });
+        context.Report("JobSystem, one job each", jobs, seconds);
+
+        const double parallelFor = Bench::MeasureSeconds([&]
+        {
+            system.ParallelFor(static_cast<uint32_t>(jobs), [&sum](const uint32_t begin, const uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; ++i) TinyWork(sum, i);
+            });
+        });
+        context.Report("JobSystem::ParallelFor", jobs, parallelFor);
+    }
+
+    {
+        std::atomic<uint64_t> done{ 0 };
+        double seconds = 0.0;
+        {
+            MutexQueue queue{ workers };
+            seconds = Bench::MeasureSeconds([&]
+            {
+                for (uint64_t i = 0; i < jobs; ++i)
+                    queue.Push([&sum, &done, i] { TinyWork(sum, i); done.fetch_add(1, std::memory_order_release); });
+                while (done.load(std::memory_order_acquire) != jobs) std::this_thread::yield();
+            });
+        }
+        context.Report("mutex queue", jobs, seconds);
+    }
+
+    {
+        // a thread per call, a hundredth of the count is plenty to see the per-job cost
+        const uint64_t calls = std::max<uint64_t>(jobs / 100, 1);
+        const double seconds = Bench::MeasureSeconds([&]
+        {
+            std::vector<std::future<void>> futures;
+            futures.reserve(calls);
+            for (uint64_t i = 0; i < calls; ++i)
+                futures.push_back(std::async(std::launch::async, [&sum, i] { TinyWork(sum, i); }));
+            for (std::future<void>& future : futures) future.wait();
+        });
+        context.Report("std::async", calls, seconds, std::format("{} calls", calls));
+    }
+
+    Bench::Escape(&sum);
+}
@@ -0,0 +1,170 @@
+#include "Bench.h"
+#include "Logger/Logger.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t PRODUCER_COUNTS[] = { 1, 2, 4, 8, 16 };
+
+    uint64_t FolderBytes(const std::filesystem::path& folder)
+    {
+        uint64_t bytes = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(folder))
+            if (entry.is_regular_file()) bytes += entry.file_size();
+        return bytes;
+    }
+
+    //~ Every producer logs `calls` lines and times each one, latency is what the calling thread pays
+    void RunProducers(Bench::Context& context, const bool async, const uint32_t producers, const uint64_t calls)
+    {
+        LOGGER_INIT_DESC desc{};
+        desc.FolderPath    = "Logs";
+        desc.FilePrefix    = async ? "bench_async" : "bench_sync";
+        desc.EnableAsync   = async;
+        desc.QueueCapacity = 64 * 1024;
+        Logger::Initialize(desc);
+
+        std::vector<std::vector<uint32_t>> samples(producers);
+        const double seconds = Bench::MeasureSeconds([&]
+        {
+            std::vector<std::thread> threads;
+            for (uint32_t t = 0; t < producers; ++t)
+            {
+                threads.emplace_back([&, t]
+                {
+                    std::vector<uint32_t>& mine = samples[t];
+                    mine.reserve(calls);
+                    for (uint64_t i = 0; i < calls; ++i)
+                    {
+                        const auto start = std::chrono::steady_clock::now();
+                        LOG_INFO("producer {} line {} value {:.3f}", t, i, static_cast<double>(i) * 0.5);
+                        const auto end = std::chrono::steady_clock::now();
+                        mine.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+                    }
+                });
+            }
+            for (std::thread& thread : threads) thread.join();
+        });
+
+        const uint64_t dropped = Logger::GetDroppedCount();
+        Logger::Terminate();
+
+        std::vector<uint32_t> all;
+        all.reserve(calls * producers);
+        for (const std::vector<uint32_t>& mine : samples) all.insert(all.end(), mine.begin(), mine.end());
+        std::ranges::sort(all);
+
+        const auto percentile = [&all](const double p) { return all[static_cast<size_t>(p * static_cast<double>(all.size() - 1))]; };
+        context.Report(std::format("{}, {:>2} producer(s)", async ? "async" : "mutex", producers), calls * producers, seconds,
+            std::format("per call p50 {} ns, p99 {} ns, max {} ns, {} dropped", percentile(0.5), percentile(0.99), all.back(), dropped));
+    }
+}
+
+FOX_BENCH(LoggerProducerLatency)
+{
+    const uint64_t calls = context.Scale(100'000);
+    for (const uint32_t producers : PRODUCER_COUNTS)
+    {
+        RunProducers(context, false, producers, calls / producers);
+        RunProducers(context, true,  producers, calls / producers);
+    }
+}
+
+//~ Same call mix through the async text backend and the binary one. Producer time is what callers pay,
+//~ the total includes the writer catching up on Terminate, the size is what lands on disk.
+FOX_BENCH(LoggerBinaryVsText)
+{
+    const uint64_t calls = context.Scale(1'000'000);
+
+    for (const bool binary : { false, true })
+    {
+        const std::filesystem::path folder = binary ? "Logs/bench_binary" : "Logs/bench_text";
+        std::filesystem::remove_all(folder);
+
+        LOGGER_INIT_DESC desc{};
+        desc.FolderPath     = folder.string();
+        desc.FilePrefix     = "bench";
+        desc.EnableAsync    = true;
+        desc.EnableBinary   = binary;
+        desc.QueueCapacity  = 64 * 1024;
+        desc.OverflowPolicy = LogOverflowPolicy::Block; // every line lands, sizes stay comparable
+
+        double producerSeconds = 0.0;
+        const double totalSeconds = Bench::MeasureSeconds([&]
+        {
+            Logger::Initialize(desc);
+            producerSeconds = Bench::MeasureSeconds([&]
+            {
+                for (uint64_t i = 0; i < calls; ++i)
+                {
+                    LOG_INFO("frame {} cpu {:.3f} ms gpu {:.3f} ms draws {} pass {}",
+                        i, static_cast<double>(i % 97) * 0.1, static_cast<double>(i % 89) * 0.1, i % 4096, "opaque");
+                }
+            });
+            Logger::Terminate();
+        });
+
+        const char* name = binary ? "binary" : "text";
+        context.Report(std::format("{} producers", name), calls, producerSeconds);
+        context.Report(std::format("{} incl. writer drain", name), calls, totalSeconds,
+            std::format("{:.2f} MB on disk, {:.1f} bytes/line", static_cast<double>(FolderBytes(folder)) / (1024.0 * 1024.0),
+                        static_cast<double>(FolderBytes(folder)) / static_cast<double>(calls)));
+    }
+}
+
+namespace
+{
+    uint64_t g_nArgumentEvaluations = 0;
+
+    double ExpensiveArgument(const uint64_t i)
+    {
+        ++g_nArgumentEvaluations;
+        return static_cast<double>(i) * 0.5;
+    }
+}
+
+//~ What a filtered out call costs the caller: the guard, nothing else. Arguments must not be evaluated.
+FOX_BENCH(LoggerDisabledCall)
+{
+    const uint64_t calls = context.Scale(50'000'000);
+
+    LOGGER_INIT_DESC desc{};
+    desc.FolderPath  = "Logs";
+    desc.FilePrefix  = "bench_disabled";
+    desc.EnableAsync = true;
+    Logger::Initialize(desc);
+    Logger::SetCategoryLevel(LogCategory::Input, FOX_LOG_LEVEL_OFF);
+
+    context.Report("empty loop", calls, Bench::MeasureSeconds([&]
+    {
+        for (uint64_t i = 0; i < calls; ++i) Bench::Escape(&i);
+    }));
+
+    g_nArgumentEvaluations = 0;
+    context.Report("LOG_INFO_CAT, category off", calls, Bench::MeasureSeconds([&]
+    {
+        for (uint64_t i = 0; i < calls; ++i)
+        {
+            LOG_INFO_CAT(Input, "key {} held for {:.3f} ms", i, ExpensiveArgument(i));
+            Bench::Escape(&i);
+        }
+    }), std::format("arguments evaluated {} time(s)", g_nArgumentEvaluations));
+
+    uint64_t guarded = 0;
+    context.Report("LOG_ENABLED guard, category off", calls, Bench::MeasureSeconds([&]
+    {
+        for (uint64_t i = 0; i < calls; ++i)
+        {
+            if (LOG_ENABLED(Input, Info)) ++guarded;
+            Bench::Escape(&i);
+        }
+    }), std::format("guarded work ran {} time(s)", guarded));
+
+    Logger::SetCategoryLevel(LogCategory::Input, FOX_LOG_LEVEL_VERBOSE);
+    Logger::Terminate();
+}
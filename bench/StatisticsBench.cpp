@@ -0,0 +1,95 @@
+#include "Bench.h"
+#include "Profiling/FrameStatistics.h"
+#include "Profiling/LatencyHistogram.h"
+
+#include <algorithm>
+#include <format>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    //~ Frame-time-like spread: mostly 2..20 ms with a long tail, precomputed so the generator is not timed
+    std::vector<uint64_t> MakeSamples(const size_t count)
+    {
+        std::mt19937_64 rng{ 42 };
+        std::lognormal_distribution<double> frameNs(15.5, 0.6);
+
+        std::vector<uint64_t> samples(count);
+        for (uint64_t& sample : samples) sample = static_cast<uint64_t>(frameNs(rng));
+        return samples;
+    }
+}
+
+//~ What a Record call costs on the frame, against keeping raw samples and sorting for the percentiles
+FOX_BENCH(LatencyHistogramRecord)
+{
+    const std::vector<uint64_t> samples = MakeSamples(64 * 1024);
+    const uint64_t records = context.Scale(20'000'000);
+
+    auto histogram = std::make_unique<LatencyHistogram>();
+    const double recordSeconds = Bench::MeasureSeconds([&]
+    {
+        for (uint64_t i = 0; i < records; ++i) histogram->Record(samples[i & (samples.size() - 1)]);
+    });
+    Bench::Escape(histogram.get());
+    context.Report("LatencyHistogram::Record", records, recordSeconds,
+        std::format("{} bytes inline", sizeof(LatencyHistogram)));
+
+    uint64_t p99 = 0;
+    const uint64_t queries = context.Scale(10'000);
+    const double querySeconds = Bench::MeasureSeconds([&]
+    {
+        for (uint64_t i = 0; i < queries; ++i) p99 += histogram->ValueAtPercentile(99.0);
+    });
+    Bench::Escape(&p99);
+    context.Report("LatencyHistogram::ValueAtPercentile", queries, querySeconds);
+
+    // one window of raw samples: push_back on record, nth_element per percentile at window close
+    std::vector<uint64_t> raw;
+    raw.reserve(samples.size());
+    const double rawSeconds = Bench::MeasureSeconds([&]
+    {
+        for (uint64_t i = 0; i < records; ++i)
+        {
+            raw.push_back(samples[i & (samples.size() - 1)]);
+            if (raw.size() == samples.size())
+            {
+                std::ranges::nth_element(raw, raw.begin() + static_cast<ptrdiff_t>(raw.size() * 99 / 100));
+                p99 += raw[raw.size() * 99 / 100];
+                raw.clear();
+            }
+        }
+    });
+    Bench::Escape(&p99);
+    context.Report("raw samples + nth_element", records, rawSeconds);
+}
+
+//~ The engine path: per-channel Record plus EndFrame rolling the windows, 16 channels like a busy frame
+FOX_BENCH(FrameStatisticsRecord)
+{
+    constexpr uint32_t CHANNEL_COUNT = 16;
+
+    const std::vector<uint64_t> samples = MakeSamples(64 * 1024);
+    const uint64_t frames = context.Scale(1'000'000);
+
+    FrameStatistics stats{};
+    uint32_t channels[CHANNEL_COUNT];
+    for (uint32_t c = 0; c < CHANNEL_COUNT; ++c) channels[c] = stats.AddChannel(std::format("Bench.{}", c));
+
+    const double seconds = Bench::MeasureSeconds([&]
+    {
+        for (uint64_t frame = 0; frame < frames; ++frame)
+        {
+            for (uint32_t c = 0; c < CHANNEL_COUNT; ++c)
+                stats.Record(channels[c], samples[(frame * CHANNEL_COUNT + c) & (samples.size() - 1)]);
+            stats.EndFrame();
+        }
+    });
+
+    const PERCENTILE_SUMMARY summary = stats.GetTotalSummary(channels[0]);
+    context.Report(std::format("{} channels + EndFrame", CHANNEL_COUNT), frames, seconds,
+        std::format("{:.1f} ns per Record incl. window rolls, p99 {:.3f} ms",
+            seconds * 1e9 / static_cast<double>(frames * CHANNEL_COUNT), summary.P99));
+}
@@ -0,0 +1,112 @@
+#include "Bench.h"
+#include "Common/Core.h"
+#include "FileSystem/FileSystem.h"
+#include "FileSystem/StreamReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <vector>
+
+namespace
+{
+    //~ Mesh-vertex sized record, parsing one is a few loads and a multiply so I/O has something to overlap with
+    typedef struct BENCH_VERTEX
+    {
+        float    Position[3];
+        float    Normal[3];
+        uint32_t Color;
+        uint32_t Index;
+    } BENCH_VERTEX;
+
+    FORCELINE uint64_t ParseVertex(const BENCH_VERTEX& vertex)
+    {
+        const float length = vertex.Normal[0] * vertex.Normal[0] + vertex.Normal[1] * vertex.Normal[1] + vertex.Normal[2] * vertex.Normal[2];
+        return vertex.Index + vertex.Color + static_cast<uint64_t>((vertex.Position[0] + vertex.Position[1] + vertex.Position[2]) * length);
+    }
+
+    bool WriteVertices(const std::string& path, const uint64_t count)
+    {
+        std::vector<BENCH_VERTEX> block(64 * 1024);
+        FileSystem file;
+        if (!file.OpenForWrite(path)) return false;
+
+        for (uint64_t written = 0; written < count; )
+        {
+            const size_t batch = static_cast<size_t>(std::min<uint64_t>(block.size(), count - written));
+            for (size_t i = 0; i < batch; ++i)
+            {
+                const float f = static_cast<float>(written + i);
+                block[i] = { { f, f + 1.0f, f + 2.0f }, { 0.0f, 1.0f, 0.0f }, 0xFFFFFFFFu, static_cast<uint32_t>(written + i) };
+            }
+            if (!file.WriteBytes(block.data(), batch * sizeof(BENCH_VERTEX))) return false;
+            written += batch;
+        }
+        file.Close();
+        return true;
+    }
+}
+
+//~ The same vertex file parsed after ReadFromFile, through StreamReader::Read one record at a time,
+//~ and straight out of NextChunk. The stream rows hold two 4 MB buffers instead of the whole file
+FOX_BENCH(StreamReaderParse)
+{
+    const uint64_t vertices = (context.IsQuick() ? 32ull : 512ull) * 1024 * 1024 / sizeof(BENCH_VERTEX);
+    const uint64_t fileSize = vertices * sizeof(BENCH_VERTEX);
+    const std::string path  = "bench_stream_vertices.bin";
+    if (!WriteVertices(path, vertices))
+    {
+        context.Note(std::format("could not write {}, skipped", path));
+        return;
+    }
+
+    uint64_t whole = 0;
+    const double wholeSeconds = Bench::MeasureSeconds([&]
+    {
+        const std::vector<char> bytes = FileSystem::ReadFromFile(path);
+        for (size_t offset = 0; offset + sizeof(BENCH_VERTEX) <= bytes.size(); offset += sizeof(BENCH_VERTEX))
+        {
+            BENCH_VERTEX vertex;
+            std::memcpy(&vertex, bytes.data() + offset, sizeof(vertex));
+            whole += ParseVertex(vertex);
+        }
+    });
+    context.Report("ReadFromFile + parse", vertices, wholeSeconds, std::format("{} MB resident", fileSize >> 20));
+
+    const STREAM_READER_DESC desc{};
+    const uint64_t streamMemory = desc.ChunkSize * desc.BufferCount;
+
+    uint64_t read = 0;
+    const double readSeconds = Bench::MeasureSeconds([&]
+    {
+        StreamReader reader{ desc };
+        if (!reader.Open(path)) return;
+        BENCH_VERTEX vertex;
+        while (reader.Read(&vertex, sizeof(vertex)) == sizeof(vertex)) read += ParseVertex(vertex);
+    });
+    context.Report("StreamReader::Read per record", vertices, readSeconds,
+        std::format("{} MB resident, {:.2f}x, {}", streamMemory >> 20, wholeSeconds / readSeconds, read == whole ? "same result" : "MISMATCH"));
+
+    // the chunk size is a multiple of the record size here, so no record straddles two chunks
+    uint64_t chunked = 0;
+    const double chunkSeconds = Bench::MeasureSeconds([&]
+    {
+        StreamReader reader{ desc };
+        if (!reader.Open(path)) return;
+        for (STREAM_CHUNK chunk = reader.NextChunk(); !chunk.Empty(); chunk = reader.NextChunk())
+        {
+            for (size_t offset = 0; offset + sizeof(BENCH_VERTEX) <= chunk.Size; offset += sizeof(BENCH_VERTEX))
+            {
+                BENCH_VERTEX vertex;
+                std::memcpy(&vertex, chunk.Data + offset, sizeof(vertex));
+                chunked += ParseVertex(vertex);
+            }
+        }
+    });
+    context.Report("StreamReader::NextChunk", vertices, chunkSeconds,
+        std::format("{} MB resident, {:.2f}x, {}", streamMemory >> 20, wholeSeconds / chunkSeconds, chunked == whole ? "same result" : "MISMATCH"));
+
+    Bench::Escape(&whole);
+    std::filesystem::remove(path);
+}
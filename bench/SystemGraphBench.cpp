@@ -0,0 +1,100 @@
+#include "Bench.h"
+#include "Engine/DependencyResolver/DependencyResolver.h"
+#include "Engine/JobSystem/JobSystem.h"
+#include "Timer/FastClock.h"
+
+#include <format>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t SYSTEM_COUNT  = 32;
+    constexpr uint32_t CHAIN_COUNT   = 8;   // systems sharing a chain write the same resource and serialise
+    constexpr double   SYSTEM_WORK_US = 20.0;
+    constexpr uint32_t CORE_COUNTS[] = { 1, 2, 4, 8, 16 };
+
+    //~ Spins for a fixed slice of CPU time and declares one write per chain: 8 chains of 4, ideal speedup 8x
+    class BenchSystem final : public ISystem
+    {
+    public:
+        BenchSystem(const uint32_t index, const uint64_t workTicks)
+            : m_nChain(index % CHAIN_COUNT), m_nWorkTicks(workTicks) {}
+
+        bool OnInit   () override { return true; }
+        void OnUpdateEnd() override {}
+        void OnRelease() override {}
+
+        void OnUpdateStart(float) override
+        {
+            const uint64_t end = FastClock::Now() + m_nWorkTicks;
+            while (FastClock::Now() < end) {}
+        }
+
+        _fox_Return_enforce FString GetSystemName() const override { return F_TEXT("BenchSystem"); }
+
+        _fox_Return_enforce bool DeclareResources(SYSTEM_RESOURCE_ACCESS& access) const override
+        {
+            access.Read("Bench.World");
+            access.Write(std::format("Bench.Chain{}", m_nChain));
+            return true;
+        }
+
+    private:
+        uint32_t m_nChain;
+        uint64_t m_nWorkTicks;
+    };
+
+    double RunFrames(DependencyResolver& resolver, const uint64_t frames)
+    {
+        resolver.UpdateStartSystems(0.0f); // wakes the workers, keep that out of the timing
+        return Bench::MeasureSeconds([&]
+        {
+            for (uint64_t frame = 0; frame < frames; ++frame) resolver.UpdateStartSystems(1.0f / 60.0f);
+        });
+    }
+}
+
+//~ 32 synthetic systems of ~20 us each through the update graph on 1-16 threads, against the serial walk
+FOX_BENCH(SystemGraphScaling)
+{
+    context.Note(std::format("{} hardware thread(s), rows past that are oversubscribed", std::thread::hardware_concurrency()));
+
+    const uint64_t frames    = context.Scale(2'000);
+    const uint64_t workTicks = static_cast<uint64_t>(SYSTEM_WORK_US * 1e-6 * static_cast<double>(FastClock::GetFrequency()));
+
+    std::vector<std::unique_ptr<BenchSystem>> systems;
+    for (uint32_t i = 0; i < SYSTEM_COUNT; ++i) systems.push_back(std::make_unique<BenchSystem>(i, workTicks));
+
+    const auto makeResolver = [&systems]
+    {
+        auto resolver = std::make_unique<DependencyResolver>();
+        for (const auto& system : systems) resolver->Register(system.get());
+        return resolver;
+    };
+
+    double serial = 0.0;
+    {
+        const auto resolver = makeResolver();
+        if (!resolver->InitializeSystems()) return;
+        serial = RunFrames(*resolver, frames);
+        context.Report("serial (no JobSystem)", frames, serial,
+            std::format("{:.1f} us per frame", serial * 1e6 / static_cast<double>(frames)));
+    }
+
+    for (const uint32_t cores : CORE_COUNTS)
+    {
+        JOB_SYSTEM_DESC desc{};
+        desc.WorkerCount = cores - 1; // the calling thread is the last core
+        JobSystem jobs{ desc };
+
+        const auto resolver = makeResolver();
+        resolver->AttachJobSystem(&jobs);
+        if (!resolver->InitializeSystems()) return;
+
+        const double seconds = RunFrames(*resolver, frames);
+        context.Report(std::format("graph, {:>2} core(s)", cores), frames, seconds,
+            std::format("{:.1f} us per frame, {:.2f}x", seconds * 1e6 / static_cast<double>(frames), serial / seconds));
+    }
+}
@@ -0,0 +1,64 @@
+#include "Bench.h"
+#include "Engine/DependencyResolver/DependencyResolver.h"
+#include "Timer/FastClock.h"
+
+#include <format>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t SYSTEM_COUNT = 32;
+
+    //~ Every phase is empty, whatever the resolver adds around the call is all there is to measure
+    class NoopSystem final : public ISystem
+    {
+    public:
+        bool OnInit     () override { return true; }
+        void OnUpdateStart(float) override {}
+        void OnUpdateEnd() override {}
+        void OnRelease  () override {}
+
+        _fox_Return_enforce FString GetSystemName() const override { return F_TEXT("NoopSystem"); }
+    };
+}
+
+//~ What timing one system call costs: UpdateEndSystems on 32 empty systems against calling them bare.
+//~ The difference per call is the instrumentation, the budget for it is 50 ns
+FOX_BENCH(SystemProfilerOverhead)
+{
+    std::vector<std::unique_ptr<NoopSystem>> systems;
+    std::vector<ISystem*> bare;
+    for (uint32_t i = 0; i < SYSTEM_COUNT; ++i)
+    {
+        bare.push_back(systems.emplace_back(std::make_unique<NoopSystem>()).get());
+    }
+
+    DependencyResolver resolver;
+    for (ISystem* system : bare) resolver.Register(system);
+    if (!resolver.InitializeSystems()) return;
+
+    const uint64_t frames = context.Scale(1'000'000);
+    const uint64_t calls  = frames * SYSTEM_COUNT;
+
+    const double bareSeconds = Bench::MeasureSeconds([&]
+    {
+        for (uint64_t frame = 0; frame < frames; ++frame)
+            for (ISystem* system : bare) system->OnUpdateEnd();
+    });
+    context.Report("bare OnUpdateEnd", calls, bareSeconds);
+
+    resolver.UpdateEndSystems(); // graph rebuild and first-sample seeding stay out of the timing
+    const double timedSeconds = Bench::MeasureSeconds([&]
+    {
+        for (uint64_t frame = 0; frame < frames; ++frame) resolver.UpdateEndSystems();
+    });
+
+    const double overheadNs = (timedSeconds - bareSeconds) * 1e9 / static_cast<double>(calls);
+    context.Report("DependencyResolver::UpdateEndSystems", calls, timedSeconds,
+        std::format("+{:.1f} ns per call, {}", overheadNs, overheadNs < 50.0 ? "within budget" : "OVER the 50 ns budget"));
+
+    const SYSTEM_PHASE_SUMMARY summary = resolver.GetProfiler().GetSummary(bare.front()->GetID(), SystemPhase::UpdateEnd);
+    context.Note(std::format("{} calls recorded for the first system, {} at {} Hz",
+        summary.Calls, FastClock::IsTscInvariant() ? "invariant TSC" : "QPC", FastClock::GetFrequency()));
+}
@@ -0,0 +1,123 @@
+#include "Bench.h"
+#include "Timer/Timer.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t READER_COUNT = 8;
+
+    //~ What Timer<T> did before the seqlock: every getter and every Tick takes the same mutex
+    class MutexTimer
+    {
+    public:
+        void Tick()
+        {
+            std::scoped_lock lock(m_mutex);
+            m_current.Delta    = 1.0 / 60.0;
+            m_current.Total   += m_current.Delta;
+            m_current.Elapsed  = m_current.Total;
+            ++m_current.FrameIndex;
+        }
+
+        TIMER_SNAPSHOT<double> GetSnapshot() const
+        {
+            std::scoped_lock lock(m_mutex);
+            return m_current;
+        }
+
+    private:
+        mutable std::mutex     m_mutex;
+        TIMER_SNAPSHOT<double> m_current{};
+    };
+
+    //~ One writer ticks flat out while READER_COUNT threads each take `reads` snapshots
+    template<typename TimerType>
+    void RunContended(Bench::Context& context, const std::string_view label, TimerType& timer, const uint64_t reads)
+    {
+        std::atomic<bool>     stop{ false };
+        std::atomic<uint64_t> ticks{ 0 };
+        std::atomic<uint64_t> torn{ 0 };
+
+        std::thread writer([&]
+        {
+            uint64_t count = 0;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                timer.Tick();
+                ++count;
+            }
+            ticks.store(count, std::memory_order_relaxed);
+        });
+
+        const double seconds = Bench::MeasureSeconds([&]
+        {
+            std::vector<std::thread> readers;
+            for (uint32_t i = 0; i < READER_COUNT; ++i)
+            {
+                readers.emplace_back([&]
+                {
+                    uint64_t lastFrame = 0;
+                    for (uint64_t r = 0; r < reads; ++r)
+                    {
+                        const TIMER_SNAPSHOT<double> snapshot = timer.GetSnapshot();
+                        if (snapshot.FrameIndex < lastFrame) torn.fetch_add(1, std::memory_order_relaxed);
+                        lastFrame = snapshot.FrameIndex;
+                        Bench::Escape(&snapshot);
+                    }
+                });
+            }
+            for (std::thread& reader : readers) reader.join();
+        });
+
+        stop.store(true, std::memory_order_relaxed);
+        writer.join();
+
+        const std::string note = std::to_string(ticks.load()) + " writer ticks, "
+                               + std::to_string(torn.load()) + " out of order";
+        context.Report(label, reads * READER_COUNT, seconds, note);
+    }
+}
+
+FOX_BENCH(TimerSnapshotUncontended)
+{
+    const uint64_t reads = context.Scale(20'000'000);
+
+    Timer<double> seqlock;
+    seqlock.Start();
+    seqlock.Tick();
+    context.Report("seqlock GetSnapshot", reads, Bench::MeasureSeconds([&]
+    {
+        for (uint64_t i = 0; i < reads; ++i)
+        {
+            const TIMER_SNAPSHOT<double> snapshot = seqlock.GetSnapshot();
+            Bench::Escape(&snapshot);
+        }
+    }));
+
+    MutexTimer locked;
+    locked.Tick();
+    context.Report("mutex GetSnapshot", reads, Bench::MeasureSeconds([&]
+    {
+        for (uint64_t i = 0; i < reads; ++i)
+        {
+            const TIMER_SNAPSHOT<double> snapshot = locked.GetSnapshot();
+            Bench::Escape(&snapshot);
+        }
+    }));
+}
+
+FOX_BENCH(TimerSnapshot8Readers)
+{
+    const uint64_t reads = context.Scale(2'000'000);
+
+    Timer<double> seqlock;
+    seqlock.Start();
+    RunContended(context, "seqlock, 8 readers + ticking writer", seqlock, reads);
+
+    MutexTimer locked;
+    RunContended(context, "mutex, 8 readers + ticking writer", locked, reads);
+}
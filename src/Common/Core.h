@@ -24,6 +24,7 @@
 #warning "You building without MSCV don't blame me if dont work"
 
     #define _fox_Return_safe        [[nodiscard]]
+    #define _fox_Return_enforce     [[nodiscard]]
     #define _fox_In_                _In_
     #define _fox_Out_               _Out_
     #define _fox_Inout_             _Inout_
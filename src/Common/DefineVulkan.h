@@ -235,15 +235,15 @@ namespace Fox
         switch (messageSeverity)
         {
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT:
-            LOG_PRINT("[VK][{}]: {}", typeStr, message);
+            LOG_PRINT_CAT(Vulkan, "[VK][{}]: {}", typeStr, message);
             break;
 
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT:
-            LOG_INFO("[VK][{}]: {}", typeStr, message);
+            LOG_INFO_CAT(Vulkan, "[VK][{}]: {}", typeStr, message);
             break;
 
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT:
-            LOG_WARNING("[VK][{}]: {}", typeStr, message);
+            LOG_WARNING_CAT(Vulkan, "[VK][{}]: {}", typeStr, message);
             break;
 
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT:
@@ -253,12 +253,12 @@ namespace Fox
             catch (const IException& e) {
                 OutputDebugStringA(e.what());
                 std::string msg = e.what();
-                LOG_ERROR("{}", msg);
+                LOG_ERROR_CAT(Vulkan, "{}", msg);
             }
             break;
 
         default:
-            LOG_PRINT("[VK][UNKNOWN]: {}", message);
+            LOG_PRINT_CAT(Vulkan, "[VK][UNKNOWN]: {}", message);
             break;
         }
 
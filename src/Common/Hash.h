@@ -0,0 +1,27 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstdint>
+#include <string_view>
+
+//~ 64-bit FNV-1a, shared by resource ids and pack paths. Step is exposed so callers can
+//~ hash a transformed view (normalized paths) without building a temporary string
+namespace FoxHash
+{
+    inline constexpr uint64_t FNV_OFFSET_BASIS{ 14695981039346656037ull };
+    inline constexpr uint64_t FNV_PRIME       { 1099511628211ull };
+
+    constexpr uint64_t Fnv1aStep(const uint64_t hash, const char c)
+    {
+        return (hash ^ static_cast<uint8_t>(c)) * FNV_PRIME;
+    }
+
+    constexpr uint64_t Fnv1a(const std::string_view text)
+    {
+        uint64_t hash = FNV_OFFSET_BASIS;
+        for (const char c : text) hash = Fnv1aStep(hash, c);
+        return hash;
+    }
+}
+
+#endif //HASH_H
@@ -0,0 +1,103 @@
+#include "CoroutineFramePool.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <new>
+
+namespace
+{
+    struct FREE_BLOCK
+    {
+        FREE_BLOCK* Next;
+    };
+
+    struct FREE_LIST
+    {
+        FREE_BLOCK* Head { nullptr };
+        uint32_t    Count{ 0 };
+    };
+
+    struct THREAD_CACHE
+    {
+        std::array<FREE_LIST, CoroutineFramePool::CLASS_COUNT> Lists{};
+        uint64_t HeapAllocations  { 0 };
+        uint64_t PooledAllocations{ 0 };
+
+        ~THREAD_CACHE()
+        {
+            for (FREE_LIST& list : Lists)
+            {
+                while (list.Head)
+                {
+                    FREE_BLOCK* next = list.Head->Next;
+                    ::operator delete(list.Head);
+                    list.Head = next;
+                }
+            }
+        }
+    };
+
+    thread_local THREAD_CACHE t_cache;
+
+    uint32_t ClassIndex(const size_t size)
+    {
+        const size_t block = std::bit_ceil(std::max(size, CoroutineFramePool::MIN_BLOCK_SIZE));
+        return static_cast<uint32_t>(std::countr_zero(block) - std::countr_zero(CoroutineFramePool::MIN_BLOCK_SIZE));
+    }
+}
+
+void* CoroutineFramePool::Allocate(const size_t size)
+{
+    if (size > MAX_BLOCK_SIZE)
+    {
+        ++t_cache.HeapAllocations;
+        return ::operator new(size);
+    }
+
+    const uint32_t index = ClassIndex(size);
+    FREE_LIST& list = t_cache.Lists[index];
+    if (list.Head)
+    {
+        FREE_BLOCK* block = list.Head;
+        list.Head = block->Next;
+        --list.Count;
+        ++t_cache.PooledAllocations;
+        return block;
+    }
+
+    ++t_cache.HeapAllocations;
+    return ::operator new(MIN_BLOCK_SIZE << index);
+}
+
+void CoroutineFramePool::Free(void* pBlock, const size_t size) noexcept
+{
+    if (pBlock == nullptr) return;
+
+    if (size > MAX_BLOCK_SIZE)
+    {
+        ::operator delete(pBlock);
+        return;
+    }
+
+    //~ a thread that only ever frees (I/O completions resuming elsewhere) must not hoard blocks forever
+    FREE_LIST& list = t_cache.Lists[ClassIndex(size)];
+    if (list.Count >= MAX_FREE_BLOCKS)
+    {
+        ::operator delete(pBlock);
+        return;
+    }
+
+    list.Head = ::new (pBlock) FREE_BLOCK{ list.Head };
+    ++list.Count;
+}
+
+uint64_t CoroutineFramePool::GetHeapAllocations()
+{
+    return t_cache.HeapAllocations;
+}
+
+uint64_t CoroutineFramePool::GetPooledAllocations()
+{
+    return t_cache.PooledAllocations;
+}
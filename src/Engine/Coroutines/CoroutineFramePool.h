@@ -0,0 +1,30 @@
+#ifndef COROUTINEFRAMEPOOL_H
+#define COROUTINEFRAMEPOOL_H
+
+#include "Common/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Power-of-two size classes (64 B .. 4 KB) with a thread-local free list each, so a coroutine
+ *        frame is recycled without touching the heap or a lock. Frames freed on another thread simply
+ *        join that thread's lists; bigger frames and overflowing lists go to the global heap.
+ */
+class CoroutineFramePool
+{
+public:
+    static constexpr size_t   MIN_BLOCK_SIZE  = 64;
+    static constexpr size_t   MAX_BLOCK_SIZE  = 4096;
+    static constexpr uint32_t CLASS_COUNT     = 7;   // 64, 128, ... 4096
+    static constexpr uint32_t MAX_FREE_BLOCKS = 256; // per class per thread
+
+    _fox_Return_enforce static void* Allocate(size_t size);
+    static void Free(void* pBlock, size_t size) noexcept;
+
+    //~ Calling thread only
+    _fox_Return_enforce static uint64_t GetHeapAllocations();
+    _fox_Return_enforce static uint64_t GetPooledAllocations();
+};
+
+#endif //COROUTINEFRAMEPOOL_H
@@ -0,0 +1,133 @@
+#include "CoroutineScheduler.h"
+#include "Logger/Logger.h"
+
+#include <exception>
+
+namespace
+{
+    //~ Owns a spawned Task: starts eagerly, frees itself at the end
+    struct DETACHED_TASK
+    {
+        struct promise_type
+        {
+            static void* operator new(const size_t size) { return CoroutineFramePool::Allocate(size); }
+            static void  operator delete(void* pFrame, const size_t size) noexcept { CoroutineFramePool::Free(pFrame, size); }
+
+            DETACHED_TASK       get_return_object  () const noexcept { return {}; }
+            std::suspend_never  initial_suspend    () const noexcept { return {}; }
+            std::suspend_never  final_suspend      () const noexcept { return {}; }
+            void                return_void        () const noexcept {}
+            void                unhandled_exception() const noexcept { std::terminate(); }
+        };
+    };
+
+    DETACHED_TASK RunDetached(Task<void> task, std::atomic<uint32_t>& spawned)
+    {
+        try
+        {
+            co_await std::move(task);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("[Coroutine] Spawned task failed: {}", e.what());
+        }
+        catch (...)
+        {
+            LOG_ERROR("[Coroutine] Spawned task failed with an unknown exception");
+        }
+        spawned.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+CoroutineScheduler::CoroutineScheduler(JobSystem& jobs)
+    : m_jobs(jobs)
+    , m_mainThreadId(std::this_thread::get_id())
+{
+    m_inbox   .reserve(64);
+    m_draining.reserve(64);
+}
+
+CoroutineScheduler::~CoroutineScheduler()
+{
+    //~ suspended frames can't be destroyed safely from here (their owners may be mid-chain), report and leak
+    if (const uint32_t live = m_nSpawned.load(std::memory_order_relaxed))
+        LOG_WARNING("[Coroutine] {} spawned task(s) still suspended at shutdown, {} waiting on a fence",
+            live, m_fenceWaits.size());
+}
+
+void CoroutineScheduler::Pump()
+{
+    //~ without workers nobody else runs worker hops and file read completions, only a Wait that found no job did
+    if (m_jobs.GetWorkerCount() == 0) (void)m_jobs.RunPostedCalls();
+
+    {
+        std::scoped_lock lock(m_inboxMutex);
+        m_draining.swap(m_inbox);
+    }
+
+    for (const PENDING_RESUME& resume : m_draining)
+    {
+        if (resume.Target == ResumeTarget::Fence) m_fenceWaits.push_back(resume);
+        else resume.Coroutine.resume();
+    }
+    m_draining.clear();
+
+    //~ anything but VK_NOT_READY resumes, a lost device is the awaiting code's to report
+    for (size_t i = 0; i < m_fenceWaits.size();)
+    {
+        const PENDING_RESUME wait = m_fenceWaits[i];
+        if (vkGetFenceStatus(wait.Device, wait.Fence) == VK_NOT_READY)
+        {
+            ++i;
+            continue;
+        }
+
+        m_fenceWaits[i] = m_fenceWaits.back();
+        m_fenceWaits.pop_back();
+        wait.Coroutine.resume();
+    }
+}
+
+void CoroutineScheduler::Spawn(Task<void> task)
+{
+    m_nSpawned.fetch_add(1, std::memory_order_relaxed);
+    RunDetached(std::move(task), m_nSpawned);
+}
+
+void CoroutineScheduler::Post(const PENDING_RESUME& resume)
+{
+    std::scoped_lock lock(m_inboxMutex);
+    m_inbox.push_back(resume);
+}
+
+void CoroutineScheduler::ResumeOnWorkerThread(const std::coroutine_handle<> handle) const
+{
+    //~ not Run: a job pushed from the main thread could be popped right back by it while it helps in Wait
+    m_jobs.PostToWorker([](void* address) { std::coroutine_handle<>::from_address(address).resume(); }, handle.address());
+}
+
+void CoroutineScheduler::WORKER_AWAITER::await_suspend(const std::coroutine_handle<> handle) const
+{
+    pScheduler->ResumeOnWorkerThread(handle);
+}
+
+void CoroutineScheduler::MAIN_THREAD_AWAITER::await_suspend(const std::coroutine_handle<> handle) const
+{
+    pScheduler->Post({ handle, ResumeTarget::MainThread });
+}
+
+void CoroutineScheduler::FENCE_AWAITER::await_suspend(const std::coroutine_handle<> handle) const
+{
+    pScheduler->Post({ handle, ResumeTarget::Fence, Device, Fence });
+}
+
+void CoroutineScheduler::FILE_READ_AWAITER::await_suspend(const std::coroutine_handle<> handle)
+{
+    //~ the completion thread only records the result, the coroutine itself continues on a worker
+    Request.OnComplete = [this, handle](const FILE_READ_REQUEST&, const FILE_READ_RESULT& result)
+    {
+        Result = result;
+        pScheduler->ResumeOnWorkerThread(handle);
+    };
+    (void)pQueue->Submit(std::move(Request));
+}
@@ -0,0 +1,131 @@
+#ifndef COROUTINESCHEDULER_H
+#define COROUTINESCHEDULER_H
+
+#include "Task.h"
+#include "Common/Core.h"
+#include "Common/DefineVulkan.h"
+#include "Engine/JobSystem/JobSystem.h"
+#include "FileSystem/AsyncFileQueue.h"
+
+#include <atomic>
+#include <coroutine>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Decides where coroutines resume. Awaitables hop a coroutine onto a job worker, back onto the
+ *        main thread, or park it until a file read or a GPU fence completes; none of them block a thread.
+ *        Pump runs once per frame on the main thread and resumes main-thread hops and signalled fences,
+ *        plus worker hops when the job system has no workers to take them.
+ *
+ *        co_await scheduler.ResumeOnWorker();            // rest of the body runs as a job
+ *        const auto read = co_await scheduler.ReadFile(queue, request);
+ *        co_await scheduler.ResumeOnMainThread();        // back for thread-bound work
+ */
+class CoroutineScheduler
+{
+public:
+    explicit CoroutineScheduler(_fox_In_ JobSystem& jobs);
+    ~CoroutineScheduler();
+
+    CoroutineScheduler(const CoroutineScheduler&)            = delete;
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+
+    //~ Main thread, once per frame
+    void Pump();
+
+    //~ Starts a task nobody awaits, its frame is freed when it finishes and failures are logged
+    void Spawn(Task<void> task);
+
+    _fox_Return_enforce bool     IsMainThread   () const { return std::this_thread::get_id() == m_mainThreadId; }
+    _fox_Return_enforce uint32_t GetSpawnedCount() const { return m_nSpawned.load(std::memory_order_relaxed); }
+
+    struct WORKER_AWAITER
+    {
+        CoroutineScheduler* pScheduler;
+
+        bool await_ready  () const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const;
+        void await_resume () const noexcept {}
+    };
+
+    struct MAIN_THREAD_AWAITER
+    {
+        CoroutineScheduler* pScheduler;
+
+        bool await_ready  () const noexcept { return pScheduler->IsMainThread(); }
+        void await_suspend(std::coroutine_handle<> handle) const;
+        void await_resume () const noexcept {}
+    };
+
+    struct FENCE_AWAITER
+    {
+        CoroutineScheduler* pScheduler;
+        VkDevice            Device;
+        VkFence             Fence;
+
+        bool     await_ready  () const { return vkGetFenceStatus(Device, Fence) == VK_SUCCESS; }
+        void     await_suspend(std::coroutine_handle<> handle) const;
+        VkResult await_resume () const { return vkGetFenceStatus(Device, Fence); }
+    };
+
+    struct FILE_READ_AWAITER
+    {
+        CoroutineScheduler* pScheduler;
+        AsyncFileQueue*     pQueue;
+        FILE_READ_REQUEST   Request;
+        FILE_READ_RESULT    Result{};
+
+        bool             await_ready  () const noexcept { return false; }
+        void             await_suspend(std::coroutine_handle<> handle);
+        FILE_READ_RESULT await_resume () const noexcept { return Result; }
+    };
+
+    //~ Resumes on a worker thread, never the main one unless the job system has no workers
+    _fox_Return_enforce WORKER_AWAITER ResumeOnWorker() { return { this }; }
+
+    //~ Resumes in the next Pump, immediately if already on the main thread
+    _fox_Return_enforce MAIN_THREAD_AWAITER ResumeOnMainThread() { return { this }; }
+
+    //~ Polled each Pump, resumes on the main thread with the fence status (VK_SUCCESS or a device error)
+    _fox_Return_enforce FENCE_AWAITER WaitForFence(VkDevice device, VkFence fence) { return { this, device, fence }; }
+
+    //~ Request.OnComplete is taken over. Resumes on a worker, Destination must outlive the await.
+    _fox_Return_enforce FILE_READ_AWAITER ReadFile(AsyncFileQueue& queue, FILE_READ_REQUEST request)
+    {
+        return { this, &queue, std::move(request) };
+    }
+
+private:
+    enum class ResumeTarget : uint8_t
+    {
+        MainThread,
+        Fence
+    };
+
+    struct PENDING_RESUME
+    {
+        std::coroutine_handle<> Coroutine;
+        ResumeTarget            Target{ ResumeTarget::MainThread };
+        VkDevice                Device{ VK_NULL_HANDLE };
+        VkFence                 Fence { VK_NULL_HANDLE };
+    };
+
+    //~ Any thread
+    void Post(const PENDING_RESUME& resume);
+    void ResumeOnWorkerThread(std::coroutine_handle<> handle) const;
+
+private:
+    JobSystem&                  m_jobs;
+    std::thread::id             m_mainThreadId;
+    std::atomic<uint32_t>       m_nSpawned{ 0 };
+
+    //~ swapped with m_draining every Pump, both keep their capacity so steady state never allocates
+    std::mutex                  m_inboxMutex;
+    std::vector<PENDING_RESUME> m_inbox;
+    std::vector<PENDING_RESUME> m_draining;
+    std::vector<PENDING_RESUME> m_fenceWaits; // main thread only
+};
+
+#endif //COROUTINESCHEDULER_H
@@ -0,0 +1,143 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include "Common/Core.h"
+#include "CoroutineFramePool.h"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+template<typename T = void>
+class Task;
+
+//~ Shared by every Task promise: pooled frames, lazy start, symmetric transfer back to whoever awaited
+struct TASK_PROMISE_BASE
+{
+    std::coroutine_handle<> Continuation{ std::noop_coroutine() };
+    std::exception_ptr      Error;
+
+    static void* operator new(const size_t size) { return CoroutineFramePool::Allocate(size); }
+    static void  operator delete(void* pFrame, const size_t size) noexcept { CoroutineFramePool::Free(pFrame, size); }
+
+    struct FINAL_AWAITER
+    {
+        bool await_ready() const noexcept { return false; }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            return handle.promise().Continuation;
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FINAL_AWAITER       final_suspend  () const noexcept { return {}; }
+
+    void unhandled_exception() noexcept { Error = std::current_exception(); }
+
+    void RethrowIfFailed() const
+    {
+        if (Error) std::rethrow_exception(Error);
+    }
+};
+
+template<typename T>
+struct TASK_PROMISE final: TASK_PROMISE_BASE
+{
+    std::optional<T> Value;
+
+    Task<T> get_return_object() noexcept;
+
+    template<typename U>
+    void return_value(U&& value) { Value.emplace(std::forward<U>(value)); }
+
+    T Take()
+    {
+        RethrowIfFailed();
+        return std::move(*Value);
+    }
+};
+
+template<>
+struct TASK_PROMISE<void> final: TASK_PROMISE_BASE
+{
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+    void Take() const { RethrowIfFailed(); }
+};
+
+/**
+ * @brief Lazy coroutine returning T. Nothing runs until the task is awaited, the awaiting coroutine is
+ *        resumed by symmetric transfer when it finishes, so chains of tasks never grow the stack.
+ *        Where the body runs is decided by the awaitables it uses (see CoroutineScheduler).
+ */
+template<typename T>
+class [[nodiscard]] Task
+{
+public:
+    using promise_type = TASK_PROMISE<T>;
+    using Handle       = std::coroutine_handle<promise_type>;
+
+     Task() = default;
+    ~Task() { if (m_handle) m_handle.destroy(); }
+
+    explicit Task(const Handle handle) noexcept : m_handle(handle) {}
+
+    Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_handle) m_handle.destroy();
+            m_handle = std::exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+
+    _fox_Return_enforce bool IsValid() const { return static_cast<bool>(m_handle); }
+    _fox_Return_enforce bool IsDone () const { return !m_handle || m_handle.done(); }
+
+    auto operator co_await() && noexcept
+    {
+        struct AWAITER
+        {
+            Handle Coroutine;
+
+            bool await_ready() const noexcept { return !Coroutine || Coroutine.done(); }
+
+            std::coroutine_handle<> await_suspend(const std::coroutine_handle<> awaiting) noexcept
+            {
+                Coroutine.promise().Continuation = awaiting;
+                return Coroutine;
+            }
+
+            T await_resume() { return Coroutine.promise().Take(); }
+        };
+        return AWAITER{ m_handle };
+    }
+
+private:
+    Handle m_handle{};
+};
+
+template<typename T>
+inline Task<T> TASK_PROMISE<T>::get_return_object() noexcept
+{
+    return Task<T>{ std::coroutine_handle<TASK_PROMISE>::from_promise(*this) };
+}
+
+inline Task<void> TASK_PROMISE<void>::get_return_object() noexcept
+{
+    return Task<void>{ std::coroutine_handle<TASK_PROMISE>::from_promise(*this) };
+}
+
+#endif //TASK_H
@@ -3,40 +3,70 @@
 //
 
 #include "DependencyResolver.h"
+#include "Engine/JobSystem/JobSystem.h"
 #include "ExceptionHandler/IException.h"
 #include "Logger/Logger.h"
 
 #include <algorithm>
 #include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 void DependencyResolver::Register(ISystem *pSystem)
 {
     if (pSystem == nullptr) return;
 
-    for (const auto& pHave: m_ppSystems)
-        if (pSystem->GetSystemName() == pHave->GetSystemName()) return;
+    //~ IDs are unique per object, comparing names built a string per registered system
+    for (const ISystem* pHave: m_ppSystems)
+        if (pSystem->GetID() == pHave->GetID()) return;
 
     m_ppSystems.emplace_back(pSystem);
+    m_bGraphDirty = true;
 }
 
 void DependencyResolver::Unregister(ISystem *pSystem)
 {
     if (pSystem == nullptr) return;
 
-    std::erase_if(m_ppSystems, [pSystem](const ISystem* s)
+    std::erase_if(m_ppSystems, [id = pSystem->GetID()](const ISystem* s)
     {
-        return s->GetSystemName() == pSystem->GetSystemName();
+        return s->GetID() == id;
     });
+
+    //~ its own edges and every edge into it, a dangling pointer here is walked by the next sort
+    m_ppSystemsDependencies.erase(pSystem);
+    for (auto it = m_ppSystemsDependencies.begin(); it != m_ppSystemsDependencies.end();)
+    {
+        std::erase(it->second, pSystem);
+        it = it->second.empty() ? m_ppSystemsDependencies.erase(it) : std::next(it);
+    }
+    m_bGraphDirty = true;
+}
+
+void DependencyResolver::AttachStatistics(FrameStatistics *pStatistics)
+{
+    m_pStatistics = pStatistics;
+    BindStatisticChannels();
 }
 
 void DependencyResolver::Clean()
 {
     m_ppSystemsDependencies.clear();
     m_ppSystems.clear();
+    m_startChannels.clear();
+    m_endChannels.clear();
+    m_profilerSlots.clear();
+    m_updateGraph.Build(m_ppSystems, m_ppSystemsDependencies);
+    m_startTicks.clear();
+    m_bGraphDirty = false;
 }
 
 bool DependencyResolver::SortTopologically()
 {
+    const std::unordered_set<ISystem*> registered(m_ppSystems.begin(), m_ppSystems.end());
     std::unordered_set<ISystem*> visited;
     std::unordered_set<ISystem*> recursionStack;
     std::vector<ISystem*> sorted;
@@ -45,7 +75,7 @@ bool DependencyResolver::SortTopologically()
     {
         if (!visited.contains(system))
         {
-            DFS(system, visited, recursionStack, sorted);
+            DFS(system, registered, visited, recursionStack, sorted);
             if (sorted.empty()) return false; // cycle detected
         }
     }
@@ -55,8 +85,197 @@ bool DependencyResolver::SortTopologically()
     return true;
 }
 
+void DependencyResolver::RebuildUpdateGraph()
+{
+    SortTopologically();
+    BindStatisticChannels();
+    BindProfilerSlots();
+
+    m_updateGraph.Build(m_ppSystems, m_ppSystemsDependencies);
+    m_startTicks.assign(m_ppSystems.size(), 0);
+    m_bGraphDirty = false;
+
+    LOG_INFO("[DependencyResolver] Update graph rebuilt: {} systems, {} edges, depth {}",
+        m_updateGraph.GetNodeCount(), m_updateGraph.GetEdgeCount(), m_updateGraph.GetDepth());
+}
+
+void DependencyResolver::BindStatisticChannels()
+{
+    m_startChannels.clear();
+    m_endChannels.clear();
+    if (m_pStatistics == nullptr) return;
+
+    //~ names are looked up once here, the update loops only index
+    for (const ISystem* system : m_ppSystems)
+    {
+        const std::string name = system->GetSystemName();
+        m_startChannels.push_back(m_pStatistics->AddChannel(name + ".UpdateStart"));
+        m_endChannels  .push_back(m_pStatistics->AddChannel(name + ".UpdateEnd"));
+    }
+}
+
+void DependencyResolver::BindProfilerSlots()
+{
+    //~ slots are keyed by ID inside the profiler, a re-sort keeps every system's history
+    m_profilerSlots.clear();
+    m_profilerSlots.reserve(m_ppSystems.size());
+    for (const ISystem* system : m_ppSystems) m_profilerSlots.push_back(m_profiler.Track(system));
+}
+
+bool DependencyResolver::RunInitialization(const std::function<bool(ISystem*)>& init)
+{
+    const size_t count = m_ppSystems.size();
+
+    std::unordered_map<ISystem*, size_t> indices;
+    for (size_t i = 0; i < count; ++i) indices.emplace(m_ppSystems[i], i);
+
+    //~ pending[i] counts unfinished dependencies, dependents[i] is who to release when i is done
+    std::vector<uint32_t>            pending(count, 0);
+    std::vector<std::vector<size_t>> dependents(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto it = m_ppSystemsDependencies.find(m_ppSystems[i]);
+        if (it == m_ppSystemsDependencies.end()) continue;
+
+        for (ISystem* dependency : it->second)
+        {
+            const auto found = indices.find(dependency);
+            if (found == indices.end()) continue;
+
+            ++pending[i];
+            dependents[found->second].push_back(i);
+        }
+    }
+
+    std::mutex              mutex;
+    std::condition_variable wake;
+    std::deque<size_t>      ready;       // any thread
+    std::deque<size_t>      readyMain;   // RequiresMainThreadInit
+    std::vector<size_t>     initialized; // completion order, unwound back to front
+    std::vector<uint64_t>   initTicks(count, SKIPPED_TICKS);
+    std::exception_ptr      error;
+    size_t                  running  { 0 };
+    bool                    failed   { false };
+    uint64_t                busyTicks{ 0 };
+
+    auto enqueue = [&](const size_t index)
+    {
+        (m_ppSystems[index]->RequiresMainThreadInit() ? readyMain : ready).push_back(index);
+    };
+    for (size_t i = 0; i < count; ++i) if (pending[i] == 0) enqueue(i);
+
+    //~ the main thread drains both queues, so with no workers this is the plain serial init
+    auto work = [&](const bool mainThread)
+    {
+        std::unique_lock lock(mutex);
+        while (true)
+        {
+            const auto finished = [&]
+            {
+                return running == 0 && (failed || (ready.empty() && readyMain.empty()));
+            };
+            const auto hasWork = [&]
+            {
+                return !failed && (!ready.empty() || (mainThread && !readyMain.empty()));
+            };
+
+            wake.wait(lock, [&] { return finished() || hasWork(); });
+            if (!hasWork()) break;
+
+            std::deque<size_t>& queue = mainThread && !readyMain.empty() ? readyMain : ready;
+            const size_t index = queue.front();
+            queue.pop_front();
+            ++running;
+            lock.unlock();
+
+            ISystem* system = m_ppSystems[index];
+            bool succeeded  = false;
+            const uint64_t start = FastClock::Now();
+            try
+            {
+                succeeded = init(system);
+            }
+            catch (...)
+            {
+                std::scoped_lock errorLock(mutex);
+                if (!error) error = std::current_exception();
+            }
+            const uint64_t elapsed = FastClock::Now() - start;
+
+            if (succeeded) LOG_INFO("[DependencyResolver] Initialise {} ({:.2f} ms)...", system->GetSystemName(), FastClock::ToMilliseconds(elapsed));
+            else           LOG_ERROR("[DependencyResolver] Failed to {}", system->GetSystemName());
+
+            lock.lock();
+            --running;
+            busyTicks += elapsed;
+            initTicks[index] = elapsed;
+
+            if (succeeded)
+            {
+                initialized.push_back(index);
+                for (const size_t dependent : dependents[index])
+                    if (--pending[dependent] == 0) enqueue(dependent);
+            }
+            else failed = true;
+
+            wake.notify_all();
+        }
+    };
+
+    const uint32_t hardware = std::max(std::thread::hardware_concurrency(), 1u);
+    const size_t   helpers  = m_pJobs ? m_pJobs->GetWorkerCount() : hardware - 1;
+    const size_t   workers  = m_bParallelInit && count > 1 ? std::min<size_t>(helpers, count - 1) : 0;
+
+    const uint64_t wallStart = FastClock::Now();
+    if (m_pJobs && workers > 0)
+    {
+        //~ one long job per helper, each sits on the condition variable between systems. Fine for a one-off
+        //~ init on workers that have nothing else to do yet
+        JOB* root = m_pJobs->CreateJob([] {});
+        for (size_t i = 0; i < workers; ++i) m_pJobs->Run(m_pJobs->CreateChildJob(root, [&work] { work(false); }));
+        m_pJobs->Run(root);
+
+        work(true);
+        m_pJobs->Wait(root);
+    }
+    else
+    {
+        //~ no JobSystem attached, borrow threads for the duration
+        std::vector<std::jthread> threads;
+        threads.reserve(workers);
+        for (size_t i = 0; i < workers; ++i) threads.emplace_back(work, false);
+
+        work(true);
+    }
+    const uint64_t wallTicks = FastClock::Now() - wallStart;
+
+    //~ recorded after the join, the profiler (and its budget callback) stays on this thread
+    for (size_t i = 0; i < count; ++i)
+        if (initTicks[i] != SKIPPED_TICKS) m_profiler.Record(m_profilerSlots[i], SystemPhase::Init, initTicks[i]);
+
+    if (failed)
+    {
+        LOG_WARNING("[DependencyResolver] Unwinding {} initialised system(s)", initialized.size());
+        for (auto it = initialized.rbegin(); it != initialized.rend(); ++it)
+        {
+            const uint64_t start = FastClock::Now();
+            m_ppSystems[*it]->OnRelease();
+            m_profiler.Record(m_profilerSlots[*it], SystemPhase::Release, FastClock::Now() - start);
+        }
+
+        if (error) std::rethrow_exception(error);
+        return false;
+    }
+
+    //~ busy time is what a serial init would have cost, wall time is what this one did
+    LOG_INFO("[DependencyResolver] {} systems initialised in {:.2f} ms on {} thread(s), {:.2f} ms of init work",
+        count, FastClock::ToMilliseconds(wallTicks), workers + 1, FastClock::ToMilliseconds(busyTicks));
+    return true;
+}
+
 void DependencyResolver::DFS(
     ISystem *node,
+    const std::unordered_set<ISystem*> &registered,
     std::unordered_set<ISystem*> &visited,
     std::unordered_set<ISystem*> &recursionStack,
     std::vector<ISystem*> &sorted)
@@ -83,7 +302,10 @@ void DependencyResolver::DFS(
     {
         for (ISystem* dep: m_ppSystemsDependencies[node])
         {
-            DFS(dep, visited, recursionStack, sorted);
+            // declared but never registered (or since unregistered), nothing to order against
+            if (!registered.contains(dep)) continue;
+
+            DFS(dep, registered, visited, recursionStack, sorted);
             if (sorted.empty()) return;
         }
     }
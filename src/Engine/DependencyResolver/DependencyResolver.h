@@ -8,11 +8,16 @@
 #include "Common/Core.h"
 #include "Interface/ISystem.h"
 #include "Logger/Logger.h"
+#include "Profiling/FrameStatistics.h"
+#include "SystemProfiler.h"
+#include "SystemTaskGraph.h"
+#include "Timer/FastClock.h"
 
 #include <functional>
 #include <unordered_set>
 
 
+//~ Runtime registry for systems only known at runtime (plugins), the engine's own go through SystemSet
 class DependencyResolver
 {
     using DependencyRegister = std::unordered_map<ISystem*, std::vector<ISystem*>>;
@@ -41,12 +46,20 @@ public:
     bool InitializeSystems(Args&... args)
     _fox_Success_(return == true);
 
+    //~ Runs on the update graph, non-conflicting systems in parallel
     template<typename... Args>
-    void UpdateStartSystems(Args... args) const;
+    void UpdateStartSystems(Args... args);
 
     template<typename... Args>
-    void UpdateEndSystems(Args... args) const;
+    void UpdateFixedSystems(Args... args);
 
+    template<typename... Args>
+    void InterpolateSystems(Args... args);
+
+    template<typename... Args>
+    void UpdateEndSystems(Args... args);
+
+    //~ Reverse dependency order, like SystemSet::ReleaseSystems
     template<typename... Args>
     void ReleaseSystems(Args&... args);
 
@@ -54,13 +67,33 @@ public:
     void AddDependency(_fox_In_ ISystem* pSystem, Args*... args)
     _fox_Pre_satisfies_(pSystem != nullptr);
 
+    //~ Independent systems init concurrently unless disabled, handy to compare startup times
+    void SetParallelInit(bool enabled) { m_bParallelInit = enabled; }
+
+    //~ Update graph and parallel init run on these workers, without one UpdateStartSystems stays serial on the caller
+    void AttachJobSystem(JobSystem* pJobs) { m_pJobs = pJobs; }
+
+    //~ Per system update times go to <name>.UpdateStart / <name>.UpdateEnd channels, nullptr detaches
+    void AttachStatistics(FrameStatistics* pStatistics);
+
+    //~ Init/UpdateStart/UpdateEnd/Release of every system is always timed here, budgets and dumps go through it
+    _fox_Return_enforce SystemProfiler&       GetProfiler()       { return m_profiler; }
+    _fox_Return_enforce const SystemProfiler& GetProfiler() const { return m_profiler; }
+
     void Clean();
 
 private:
     bool SortTopologically();
+    void BindStatisticChannels();
+    void BindProfilerSlots();
+    void RebuildUpdateGraph();
+
+    //~ Kahn ready set over m_ppSystems, unwinds what succeeded in reverse order on failure
+    _fox_Return_enforce bool RunInitialization(const std::function<bool(ISystem*)>& init);
 
     void DFS(
         _fox_In_ ISystem* node,
+        _fox_In_ const std::unordered_set<ISystem*>& registered,
         _fox_Inout_ std::unordered_set<ISystem*>& visited,
         _fox_Inout_ std::unordered_set<ISystem*>& recursionStack,
         _fox_Inout_ std::vector<ISystem*>& sorted
@@ -69,6 +102,23 @@ private:
 private:
     std::vector<ISystem*> m_ppSystems;
     DependencyRegister    m_ppSystemsDependencies;
+    bool                  m_bParallelInit{ true };
+
+    //~ rebuilt lazily after Register/Unregister/AddDependency, never per frame
+    SystemTaskGraph       m_updateGraph{};
+    JobSystem*            m_pJobs{ nullptr };
+    std::vector<uint64_t> m_startTicks;           // SKIPPED_TICKS for systems that didn't run this frame
+    bool                  m_bGraphDirty{ true };
+
+    static constexpr uint64_t SKIPPED_TICKS = UINT64_MAX;
+
+    //~ parallel to m_ppSystems, rebuilt whenever the order changes
+    FrameStatistics*      m_pStatistics{ nullptr };
+    std::vector<uint32_t> m_startChannels;
+    std::vector<uint32_t> m_endChannels;
+
+    SystemProfiler        m_profiler{};
+    std::vector<uint32_t> m_profilerSlots;        // parallel to m_ppSystems
 };
 
 template<typename ... Args>
@@ -90,43 +140,94 @@ template<typename ... Args>
 inline bool DependencyResolver::InitializeSystems(Args &...args)
 {
     LOG_WARNING("Attempting to initialize systems...");
-    SortTopologically();
+    RebuildUpdateGraph();
 
-    for (ISystem* system: m_ppSystems)
+    if (!RunInitialization([&](ISystem* system) { return system->OnInit(args...); })) return false;
+
+    LOG_SUCCESS("[DependencyResolver] Initialisation done.");
+    return true;
+}
+
+template<typename ... Args>
+inline void DependencyResolver::UpdateStartSystems(Args...args)
+{
+    if (m_bGraphDirty) RebuildUpdateGraph();
+
+    m_updateGraph.Execute(m_pJobs, [&](ISystem* system, const uint32_t index)
     {
-        if (!system->OnInit(args...))
+        if (system->GetTickPolicy() != SystemTickPolicy::Variable)
         {
-            LOG_ERROR("[DependencyResolver] Failed to {}", system->GetSystemName());
-            return false;
+            m_startTicks[index] = SKIPPED_TICKS;
+            return;
         }
-        LOG_INFO("[DependencyResolver] Initialise {}...", system->GetSystemName());
+
+        const uint64_t start = FastClock::Now();
+        system->OnUpdateStart(args...);
+        m_startTicks[index] = FastClock::Now() - start;
+    });
+
+    //~ the profiler and FrameStatistics are main thread only, workers leave their times in m_startTicks
+    for (size_t i = 0; i < m_startTicks.size(); ++i)
+    {
+        if (m_startTicks[i] == SKIPPED_TICKS) continue;
+
+        m_profiler.Record(m_profilerSlots[i], SystemPhase::UpdateStart, m_startTicks[i]);
+        if (m_pStatistics && i < m_startChannels.size()) m_pStatistics->RecordTicks(m_startChannels[i], m_startTicks[i]);
     }
-    LOG_SUCCESS("[DependencyResolver] Initialisation done.");
-    return true;
 }
 
 template<typename ... Args>
-inline void DependencyResolver::UpdateStartSystems(Args...args) const
+inline void DependencyResolver::UpdateFixedSystems(Args...args)
 {
-    for (ISystem* system: m_ppSystems) system->OnUpdateStart(args...);
+    if (m_bGraphDirty) RebuildUpdateGraph();
+
+    for (ISystem* system: m_ppSystems)
+        if (system->GetTickPolicy() == SystemTickPolicy::Fixed) system->OnFixedUpdate(args...);
 }
 
 template<typename ... Args>
-inline void DependencyResolver::UpdateEndSystems(Args...args) const
+inline void DependencyResolver::InterpolateSystems(Args...args)
 {
-    for (ISystem* system: m_ppSystems) system->OnUpdateEnd(args...);
+    if (m_bGraphDirty) RebuildUpdateGraph();
+
+    for (ISystem* system: m_ppSystems) system->OnInterpolate(args...);
+}
+
+template<typename ... Args>
+inline void DependencyResolver::UpdateEndSystems(Args...args)
+{
+    if (m_bGraphDirty) RebuildUpdateGraph();
+
+    for (size_t i = 0; i < m_ppSystems.size(); ++i)
+    {
+        const uint64_t start = FastClock::Now();
+        m_ppSystems[i]->OnUpdateEnd(args...);
+        const uint64_t elapsed = FastClock::Now() - start;
+
+        m_profiler.Record(m_profilerSlots[i], SystemPhase::UpdateEnd, elapsed);
+        if (m_pStatistics && i < m_endChannels.size()) m_pStatistics->RecordTicks(m_endChannels[i], elapsed);
+    }
 }
 
 template<typename ... Args>
 inline void DependencyResolver::ReleaseSystems(Args &...args)
 {
-    for (ISystem* system: m_ppSystems) system->OnRelease(args...);
+    if (m_bGraphDirty) RebuildUpdateGraph();
+
+    //~ m_ppSystems is topologically sorted, dependents go before whatever they depend on
+    for (size_t i = m_ppSystems.size(); i-- > 0;)
+    {
+        const uint64_t start = FastClock::Now();
+        m_ppSystems[i]->OnRelease(args...);
+        m_profiler.Record(m_profilerSlots[i], SystemPhase::Release, FastClock::Now() - start);
+    }
 }
 
 template<typename ... Args>
 inline void DependencyResolver::AddDependency(ISystem *pSystem, Args*...args)
 {
     (m_ppSystemsDependencies[pSystem].emplace_back(args), ...);
+    m_bGraphDirty = true;
 }
 
 #endif //DEPENDENCYRESOLVER_H
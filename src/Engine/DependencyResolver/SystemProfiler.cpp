@@ -0,0 +1,173 @@
+#include "SystemProfiler.h"
+#include "FileSystem/FileSystem.h"
+#include "Logger/Logger.h"
+#include "Timer/FastClock.h"
+
+#include <bit>
+#include <format>
+
+SystemProfiler::SystemProfiler(const SYSTEM_PROFILER_DESC& desc)
+    : m_desc(desc)
+{
+    m_desc.Smoothing       = std::clamp(m_desc.Smoothing, 1e-4, 1.0);
+    m_fMillisecondsPerTick = 1e3 / static_cast<double>(FastClock::GetFrequency());
+}
+
+uint32_t SystemProfiler::Track(const ISystem* system)
+{
+    if (const auto it = m_slots.find(system->GetID()); it != m_slots.end()) return it->second;
+
+    ENTRY& entry = m_entries.emplace_back();
+    entry.Id   = system->GetID();
+    entry.Name = system->GetSystemName();
+    for (uint32_t phase = 0; phase < PHASE_COUNT; ++phase) entry.Phases[phase].Budget = m_defaultBudgets[phase];
+
+    const uint32_t slot = static_cast<uint32_t>(m_entries.size() - 1);
+    m_slots.emplace(entry.Id, slot);
+    return slot;
+}
+
+void SystemProfiler::SetBudget(const SystemPhase phase, const double milliseconds)
+{
+    const uint32_t index = static_cast<uint32_t>(phase);
+    m_defaultBudgets[index] = ToTicks(milliseconds);
+
+    for (ENTRY& entry : m_entries)
+        if (!entry.Phases[index].Override) entry.Phases[index].Budget = m_defaultBudgets[index];
+}
+
+void SystemProfiler::SetBudget(const ID system, const SystemPhase phase, const double milliseconds)
+{
+    const auto it = m_slots.find(system);
+    if (it == m_slots.end())
+    {
+        LOG_WARNING("[SystemProfiler] Budget for untracked system #{} ignored", system);
+        return;
+    }
+
+    PHASE_TIMING& timing = m_entries[it->second].Phases[static_cast<uint32_t>(phase)];
+    timing.Budget   = ToTicks(milliseconds);
+    timing.Override = true;
+}
+
+SYSTEM_PHASE_SUMMARY SystemProfiler::GetSummary(const ID system, const SystemPhase phase) const
+{
+    const auto it = m_slots.find(system);
+    if (it == m_slots.end()) return {};
+
+    return Summarize(m_entries[it->second].Phases[static_cast<uint32_t>(phase)]);
+}
+
+std::vector<ID> SystemProfiler::GetTrackedSystems() const
+{
+    std::vector<ID> ids;
+    ids.reserve(m_entries.size());
+    for (const ENTRY& entry : m_entries) ids.push_back(entry.Id);
+    return ids;
+}
+
+std::string_view SystemProfiler::GetPhaseName(const SystemPhase phase)
+{
+    switch (phase)
+    {
+    case SystemPhase::Init:        return "Init";
+    case SystemPhase::UpdateStart: return "UpdateStart";
+    case SystemPhase::UpdateEnd:   return "UpdateEnd";
+    case SystemPhase::Release:     return "Release";
+    default:                       return "Unknown";
+    }
+}
+
+void SystemProfiler::LogSummary() const
+{
+    //~ slowest frame cost first, that's the line people look for
+    std::vector<const ENTRY*> sorted;
+    sorted.reserve(m_entries.size());
+    for (const ENTRY& entry : m_entries) sorted.push_back(&entry);
+
+    std::ranges::sort(sorted, [](const ENTRY* a, const ENTRY* b)
+    {
+        const auto frameCost = [](const ENTRY* e)
+        {
+            return e->Phases[static_cast<uint32_t>(SystemPhase::UpdateStart)].Average
+                 + e->Phases[static_cast<uint32_t>(SystemPhase::UpdateEnd)].Average;
+        };
+        return frameCost(a) > frameCost(b);
+    });
+
+    for (const ENTRY* entry : sorted)
+    {
+        const SYSTEM_PHASE_SUMMARY init    = Summarize(entry->Phases[static_cast<uint32_t>(SystemPhase::Init)]);
+        const SYSTEM_PHASE_SUMMARY start   = Summarize(entry->Phases[static_cast<uint32_t>(SystemPhase::UpdateStart)]);
+        const SYSTEM_PHASE_SUMMARY end     = Summarize(entry->Phases[static_cast<uint32_t>(SystemPhase::UpdateEnd)]);
+        const SYSTEM_PHASE_SUMMARY release = Summarize(entry->Phases[static_cast<uint32_t>(SystemPhase::Release)]);
+
+        LOG_INFO("[SystemProfiler] {} (#{}): init {:.3f} ms | start avg {:.3f} max {:.3f} ms | end avg {:.3f} max {:.3f} ms | release {:.3f} ms | {} overrun(s)",
+            entry->Name, entry->Id, init.Total, start.Average, start.Max, end.Average, end.Max, release.Total,
+            init.Overruns + start.Overruns + end.Overruns + release.Overruns);
+    }
+}
+
+bool SystemProfiler::ExportCsv(const std::string& path) const
+{
+    FileSystem file;
+    if (!file.OpenForWrite(path)) return false;
+
+    file.WritePlainText("system_id,system,phase,calls,last_ms,average_ms,max_ms,total_ms,budget_ms,overruns\n");
+    for (const ENTRY& entry : m_entries)
+    {
+        for (uint32_t phase = 0; phase < PHASE_COUNT; ++phase)
+        {
+            const SYSTEM_PHASE_SUMMARY s = Summarize(entry.Phases[phase]);
+            file.WritePlainText(std::format("{},{},{},{},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{}\n",
+                entry.Id, entry.Name, GetPhaseName(static_cast<SystemPhase>(phase)),
+                s.Calls, s.Last, s.Average, s.Max, s.Total, s.Budget, s.Overruns));
+        }
+    }
+
+    file.Flush();
+    file.Close();
+    return true;
+}
+
+void SystemProfiler::ExportAll() const
+{
+    LogSummary();
+    if (!ExportCsv(m_desc.CsvPath)) LOG_WARNING("[SystemProfiler] Failed to write {}", m_desc.CsvPath);
+}
+
+uint64_t SystemProfiler::ToTicks(const double milliseconds) const
+{
+    return milliseconds <= 0.0 ? 0 : static_cast<uint64_t>(milliseconds / m_fMillisecondsPerTick);
+}
+
+SYSTEM_PHASE_SUMMARY SystemProfiler::Summarize(const PHASE_TIMING& timing) const
+{
+    SYSTEM_PHASE_SUMMARY summary{};
+    summary.Calls    = timing.Calls;
+    summary.Overruns = timing.Overruns;
+    summary.Last     = static_cast<double>(timing.Last)   * m_fMillisecondsPerTick;
+    summary.Average  = timing.Average                     * m_fMillisecondsPerTick;
+    summary.Max      = static_cast<double>(timing.Max)    * m_fMillisecondsPerTick;
+    summary.Total    = static_cast<double>(timing.Total)  * m_fMillisecondsPerTick;
+    summary.Budget   = static_cast<double>(timing.Budget) * m_fMillisecondsPerTick;
+    return summary;
+}
+
+void SystemProfiler::OnOverrun(const uint32_t slot, const SystemPhase phase, const uint64_t ticks)
+{
+    const ENTRY&  entry  = m_entries[slot];
+    PHASE_TIMING& timing = m_entries[slot].Phases[static_cast<uint32_t>(phase)];
+    ++timing.Overruns;
+
+    //~ doubling back-off, the first overrun always reports
+    if (!m_onBudgetExceeded || !std::has_single_bit(timing.Overruns)) return;
+    m_onBudgetExceeded({
+        entry.Id,
+        entry.Name,
+        phase,
+        static_cast<double>(ticks)         * m_fMillisecondsPerTick,
+        static_cast<double>(timing.Budget) * m_fMillisecondsPerTick,
+        timing.Overruns
+    });
+}
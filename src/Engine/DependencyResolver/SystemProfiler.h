@@ -0,0 +1,143 @@
+#ifndef SYSTEMPROFILER_H
+#define SYSTEMPROFILER_H
+
+#include "Common/Core.h"
+#include "Interface/ISystem.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+enum class SystemPhase : uint8_t
+{
+    Init,
+    UpdateStart,
+    UpdateEnd,
+    Release,
+    Count
+};
+
+//~ Milliseconds
+typedef struct SYSTEM_PHASE_SUMMARY
+{
+    uint64_t Calls   { 0 };
+    uint64_t Overruns{ 0 };
+    double   Last    { 0.0 };
+    double   Average { 0.0 }; // rolling, see SYSTEM_PROFILER_DESC::Smoothing
+    double   Max     { 0.0 };
+    double   Total   { 0.0 };
+    double   Budget  { 0.0 }; // 0: unchecked
+} SYSTEM_PHASE_SUMMARY;
+
+typedef struct SYSTEM_BUDGET_EVENT
+{
+    ID               SystemId;
+    std::string_view Name;
+    SystemPhase      Phase;
+    double           Milliseconds;
+    double           BudgetMilliseconds;
+    uint64_t         Overruns;     // including this one, always a power of two (see SetBudgetCallback)
+} SYSTEM_BUDGET_EVENT;
+
+using SystemBudgetCallback = std::function<void(const SYSTEM_BUDGET_EVENT&)>;
+
+typedef struct SYSTEM_PROFILER_DESC
+{
+    double      Smoothing = 0.05; // weight of the newest sample in the rolling average, ~20 calls of memory
+    std::string CsvPath   = "Logs\\SystemTimings.csv";
+} SYSTEM_PROFILER_DESC;
+
+/**
+ * @brief Per system timings of every ISystem phase, keyed by FObject::GetID so a name is only ever built
+ *        when a system is first tracked. Track hands out a slot once, Record on a slot is a handful of
+ *        adds and compares and never allocates. Main thread only, workers hand their ticks over.
+ */
+class SystemProfiler
+{
+public:
+    static constexpr uint32_t PHASE_COUNT = static_cast<uint32_t>(SystemPhase::Count);
+
+    explicit SystemProfiler(const SYSTEM_PROFILER_DESC& desc = {});
+    ~SystemProfiler() = default;
+
+    SystemProfiler(const SystemProfiler&)            = delete;
+    SystemProfiler& operator=(const SystemProfiler&) = delete;
+
+    //~ Setup time, the same system always gets the same slot back
+    _fox_Return_enforce uint32_t Track(_fox_In_ const ISystem* system);
+
+    FORCELINE void Record(uint32_t slot, SystemPhase phase, uint64_t fastClockTicks);
+
+    //~ The phase default applies to every tracked system and to those tracked later, a per system budget overrides it
+    void SetBudget(SystemPhase phase, double milliseconds);
+    void SetBudget(ID system, SystemPhase phase, double milliseconds);
+    //~ Fires on the 1st, 2nd, 4th, 8th... overrun of a system phase, a chronic offender backs off instead of flooding.
+    //~ Every overrun is still counted in the summary and the CSV.
+    void SetBudgetCallback(SystemBudgetCallback callback) { m_onBudgetExceeded = std::move(callback); }
+
+    _fox_Return_enforce SYSTEM_PHASE_SUMMARY GetSummary(ID system, SystemPhase phase) const;
+    _fox_Return_enforce std::vector<ID>      GetTrackedSystems() const;
+
+    _fox_Return_enforce static std::string_view GetPhaseName(SystemPhase phase);
+
+    void LogSummary() const;
+    bool ExportCsv(const std::string& path) const;
+
+    //~ Logs the table and writes the csv from the desc
+    void ExportAll() const;
+
+private:
+    //~ FastClock ticks
+    struct PHASE_TIMING
+    {
+        uint64_t Calls    { 0 };
+        uint64_t Overruns { 0 };
+        uint64_t Last     { 0 };
+        uint64_t Max      { 0 };
+        uint64_t Total    { 0 };
+        uint64_t Budget   { 0 };
+        double   Average  { 0.0 };
+        bool     Override { false }; // budget set for this system, the phase default leaves it alone
+    };
+
+    struct ENTRY
+    {
+        ID                                     Id;
+        std::string                            Name;
+        std::array<PHASE_TIMING, PHASE_COUNT>  Phases{};
+    };
+
+    _fox_Return_enforce uint64_t ToTicks(double milliseconds) const;
+    SYSTEM_PHASE_SUMMARY Summarize(const PHASE_TIMING& timing) const;
+    void OnOverrun(uint32_t slot, SystemPhase phase, uint64_t ticks);
+
+private:
+    SYSTEM_PROFILER_DESC                   m_desc;
+    std::vector<ENTRY>                     m_entries;
+    std::unordered_map<ID, uint32_t>       m_slots;
+    std::array<uint64_t, PHASE_COUNT>      m_defaultBudgets{};
+    SystemBudgetCallback                   m_onBudgetExceeded;
+    double                                 m_fMillisecondsPerTick{ 1.0 };
+};
+
+inline void SystemProfiler::Record(const uint32_t slot, const SystemPhase phase, const uint64_t fastClockTicks)
+{
+    PHASE_TIMING& timing = m_entries[slot].Phases[static_cast<uint32_t>(phase)];
+
+    //~ the first sample seeds the average, otherwise a one-off Init would read as 5% of itself
+    const double sample = static_cast<double>(fastClockTicks);
+    timing.Average = timing.Calls == 0 ? sample : timing.Average + (sample - timing.Average) * m_desc.Smoothing;
+
+    ++timing.Calls;
+    timing.Last   = fastClockTicks;
+    timing.Total += fastClockTicks;
+    timing.Max    = std::max(timing.Max, fastClockTicks);
+
+    if (timing.Budget != 0 && fastClockTicks > timing.Budget) OnOverrun(slot, phase, fastClockTicks);
+}
+
+#endif //SYSTEMPROFILER_H
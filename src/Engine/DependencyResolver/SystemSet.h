@@ -0,0 +1,353 @@
+#ifndef SYSTEMSET_H
+#define SYSTEMSET_H
+
+#include "Common/Core.h"
+#include "Interface/ISystem.h"
+#include "Logger/Logger.h"
+#include "Profiling/FrameStatistics.h"
+#include "SystemProfiler.h"
+#include "Timer/FastClock.h"
+
+#include <array>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//~ Outside SystemSet on purpose: a class can't evaluate its own member functions in its static initialisers
+namespace SystemOrder
+{
+    //~ Position of T in Ts, sizeof...(Ts) when absent
+    template<typename T, typename... Ts>
+    constexpr size_t IndexOf()
+    {
+        size_t index = 0;
+        const bool found = ((std::is_same_v<T, Ts> ? true : (++index, false)) || ...);
+        return found ? index : sizeof...(Ts);
+    }
+
+    template<typename... Ts>
+    constexpr bool Unique()
+    {
+        size_t position = 0;
+        return ((IndexOf<Ts, Ts...>() == position++) && ...);
+    }
+
+    template<typename... Ts, typename... Deps>
+    constexpr bool AllInSet(SystemList<Deps...>) { return ((IndexOf<Deps, Ts...>() < sizeof...(Ts)) && ...); }
+
+    template<typename... Ts, size_t N, typename... Deps>
+    constexpr void MarkEdges(std::array<bool, N>& edges, const size_t index, SystemList<Deps...>)
+    {
+        ((edges[index * sizeof...(Ts) + IndexOf<Deps, Ts...>()] = true), ...);
+    }
+
+    template<size_t N>
+    struct ORDERING
+    {
+        std::array<size_t, N> Order{}; // rank -> index into Ts
+        size_t                Count{ 0 };
+    };
+
+    //~ Kahn, lowest declared index first among the ready ones so declaration order breaks ties
+    template<typename... Ts>
+    constexpr ORDERING<sizeof...(Ts)> Sort()
+    {
+        constexpr size_t count = sizeof...(Ts);
+
+        std::array<bool, count * count> edges{}; // edges[i * count + j]: i needs j
+        size_t index = 0;
+        (MarkEdges<Ts...>(edges, index++, typename SystemDependencies<Ts>::Types{}), ...);
+
+        ORDERING<count> ordering{};
+        std::array<bool, count> placed{};
+        while (ordering.Count < count)
+        {
+            size_t next = count;
+            for (size_t i = 0; i < count && next == count; ++i)
+            {
+                if (placed[i]) continue;
+
+                bool ready = true;
+                for (size_t j = 0; j < count; ++j)
+                    if (edges[i * count + j] && !placed[j]) ready = false;
+                if (ready) next = i;
+            }
+            if (next == count) break; // everything left waits on something else left: a cycle
+
+            placed[next] = true;
+            ordering.Order[ordering.Count++] = next;
+        }
+        return ordering;
+    }
+}
+
+/**
+ * @brief Fixed set of engine systems known at compile time. Order comes from SystemDependencies,
+ *        sorted when the type is instantiated, a cycle or a dependency outside the set does not compile.
+ *        Every phase is a fold over the sorted tuple with qualified calls, which are direct and inlinable.
+ *        A qualified call skips virtual dispatch outright, so every system type has to be final: a subclass
+ *        bound through a base type would silently get the base's phases. Systems are not owned, plugins keep
+ *        using DependencyResolver.
+ *
+ *        SystemSet<WindowsManager, RenderManager> core;
+ *        core.Bind(pWindows, pRender);
+ *        core.InitializeSystems();
+ */
+template<typename... Ts>
+class SystemSet
+{
+    static_assert(sizeof...(Ts) > 0,                       "SystemSet needs at least one system");
+    static_assert((std::is_base_of_v<ISystem, Ts> && ...), "All SystemSet types must be derived from ISystem");
+    static_assert((std::is_final_v<Ts> && ...),            "SystemSet calls T::OnX() directly, every system type must be final");
+    static_assert(SystemOrder::Unique<Ts...>(),            "A system type is listed twice in the SystemSet");
+    static_assert((SystemOrder::AllInSet<Ts...>(typename SystemDependencies<Ts>::Types{}) && ...),
+        "A system depends on a type that is not part of this SystemSet");
+
+public:
+    static constexpr size_t COUNT = sizeof...(Ts);
+
+     SystemSet() = default;
+    ~SystemSet() = default;
+
+    SystemSet(const SystemSet&)            = delete;
+    SystemSet& operator=(const SystemSet&) = delete;
+
+    void Bind(_fox_In_ Ts*... systems);
+
+    //~ Same channels and phases as DependencyResolver, both are optional and main thread only
+    void AttachProfiler  (SystemProfiler*  pProfiler);
+    void AttachStatistics(FrameStatistics* pStatistics);
+
+    //~ Dependency order, on failure (or a throw) the initialised ones are released in reverse
+    _fox_Return_enforce bool InitializeSystems()
+    _fox_Success_(return == true);
+
+    void UpdateStartSystems(float deltaTime);
+    void UpdateFixedSystems(float fixedDeltaTime);
+    void InterpolateSystems(float alpha);
+    void UpdateEndSystems  ();
+
+    //~ Reverse dependency order, only what InitializeSystems got through
+    void ReleaseSystems();
+
+    template<typename T>
+    _fox_Return_enforce T* Get() const { return std::get<T*>(m_systems); }
+
+    template<typename T>
+    static constexpr size_t IndexOf() { return SystemOrder::IndexOf<T, Ts...>(); }
+
+private:
+    static constexpr SystemOrder::ORDERING<COUNT> SORTED = SystemOrder::Sort<Ts...>();
+    static_assert(SORTED.Count == COUNT, "SystemSet dependencies form a cycle");
+
+    template<size_t Rank>
+    using SystemAt = std::tuple_element_t<SORTED.Order[Rank], std::tuple<Ts...>>;
+
+    //~ fn(T* system, size_t index) in dependency order
+    template<typename Fn, size_t... Rank>
+    FORCELINE void ForEachOrdered(Fn&& fn, std::index_sequence<Rank...>)
+    {
+        (fn(std::get<SORTED.Order[Rank]>(m_systems), SORTED.Order[Rank]), ...);
+    }
+
+    template<typename Fn>
+    FORCELINE void ForEachOrdered(Fn&& fn) { ForEachOrdered(std::forward<Fn>(fn), std::make_index_sequence<COUNT>{}); }
+
+    //~ Times fn when anyone listens, channel is INVALID_CHANNEL for phases without statistics
+    template<typename Fn>
+    FORCELINE void Measure(size_t index, SystemPhase phase, uint32_t channel, Fn&& fn);
+
+    _fox_Return_enforce bool InitializeOrdered();
+    void ReleaseInitialized(size_t count);
+
+private:
+    std::tuple<Ts*...>          m_systems{};
+    size_t                      m_nInitialized{ 0 }; // ranks [0, m_nInitialized) are live
+
+    SystemProfiler*             m_pProfiler  { nullptr };
+    FrameStatistics*            m_pStatistics{ nullptr };
+    std::array<uint32_t, COUNT> m_profilerSlots{};
+    std::array<uint32_t, COUNT> m_startChannels{};
+    std::array<uint32_t, COUNT> m_endChannels{};
+};
+
+
+template<typename ... Ts>
+inline void SystemSet<Ts...>::Bind(Ts*... systems)
+{
+    m_systems = { systems... };
+    if (m_pProfiler)   AttachProfiler(m_pProfiler);
+    if (m_pStatistics) AttachStatistics(m_pStatistics);
+}
+
+template<typename ... Ts>
+inline void SystemSet<Ts...>::AttachProfiler(SystemProfiler* pProfiler)
+{
+    m_pProfiler = pProfiler;
+    if (!m_pProfiler) return;
+
+    size_t index = 0;
+    ((m_profilerSlots[index++] = std::get<Ts*>(m_systems) ? m_pProfiler->Track(std::get<Ts*>(m_systems)) : 0), ...);
+}
+
+template<typename ... Ts>
+inline void SystemSet<Ts...>::AttachStatistics(FrameStatistics* pStatistics)
+{
+    m_pStatistics = pStatistics;
+    m_startChannels.fill(FrameStatistics::INVALID_CHANNEL);
+    m_endChannels  .fill(FrameStatistics::INVALID_CHANNEL);
+    if (!m_pStatistics) return;
+
+    //~ names are looked up once here, the update folds only index
+    size_t index = 0;
+    auto bind = [&](const ISystem* system)
+    {
+        if (system)
+        {
+            const std::string name = system->GetSystemName();
+            m_startChannels[index] = m_pStatistics->AddChannel(name + ".UpdateStart");
+            m_endChannels  [index] = m_pStatistics->AddChannel(name + ".UpdateEnd");
+        }
+        ++index;
+    };
+    (bind(std::get<Ts*>(m_systems)), ...);
+}
+
+template<typename ... Ts>
+template<typename Fn>
+inline void SystemSet<Ts...>::Measure(const size_t index, const SystemPhase phase, const uint32_t channel, Fn&& fn)
+{
+    if (!m_pProfiler && (!m_pStatistics || channel == FrameStatistics::INVALID_CHANNEL))
+    {
+        fn();
+        return;
+    }
+
+    const uint64_t start = FastClock::Now();
+    fn();
+    const uint64_t elapsed = FastClock::Now() - start;
+
+    if (m_pProfiler) m_pProfiler->Record(m_profilerSlots[index], phase, elapsed);
+    if (m_pStatistics && channel != FrameStatistics::INVALID_CHANNEL) m_pStatistics->RecordTicks(channel, elapsed);
+}
+
+template<typename ... Ts>
+inline bool SystemSet<Ts...>::InitializeSystems()
+{
+    if (((std::get<Ts*>(m_systems) == nullptr) || ...))
+    {
+        LOG_ERROR("[SystemSet] Initialise called before every system was bound");
+        return false;
+    }
+
+    const uint64_t start = FastClock::Now();
+    try
+    {
+        if (!InitializeOrdered())
+        {
+            ReleaseInitialized(m_nInitialized);
+            return false;
+        }
+    }
+    catch (...)
+    {
+        ReleaseInitialized(m_nInitialized);
+        throw;
+    }
+
+    LOG_INFO("[SystemSet] {} systems initialised in {:.2f} ms", COUNT, FastClock::ToMilliseconds(FastClock::Now() - start));
+    return true;
+}
+
+template<typename ... Ts>
+inline bool SystemSet<Ts...>::InitializeOrdered()
+{
+    m_nInitialized = 0;
+
+    //~ && stops the fold at the first failure, m_nInitialized is how far it got
+    auto init = [this]<size_t... Rank>(std::index_sequence<Rank...>)
+    {
+        return ([this]
+        {
+            constexpr size_t index = SORTED.Order[Rank];
+            using T = SystemAt<Rank>;
+            T* system = std::get<index>(m_systems);
+
+            bool succeeded = false;
+            Measure(index, SystemPhase::Init, FrameStatistics::INVALID_CHANNEL, [&] { succeeded = system->T::OnInit(); });
+            if (!succeeded)
+            {
+                LOG_ERROR("[SystemSet] Failed to {}", system->GetSystemName());
+                return false;
+            }
+
+            LOG_INFO("[SystemSet] Initialise {}...", system->GetSystemName());
+            ++m_nInitialized;
+            return true;
+        }() && ...);
+    };
+    return init(std::make_index_sequence<COUNT>{});
+}
+
+template<typename ... Ts>
+inline void SystemSet<Ts...>::ReleaseInitialized(const size_t count)
+{
+    auto release = [this, count]<size_t... Reverse>(std::index_sequence<Reverse...>)
+    {
+        ([this, count]
+        {
+            constexpr size_t rank  = COUNT - 1 - Reverse;
+            constexpr size_t index = SORTED.Order[rank];
+            using T = SystemAt<rank>;
+
+            if (rank >= count) return;
+            T* system = std::get<index>(m_systems);
+            Measure(index, SystemPhase::Release, FrameStatistics::INVALID_CHANNEL, [system] { system->T::OnRelease(); });
+        }(), ...);
+    };
+    release(std::make_index_sequence<COUNT>{});
+    m_nInitialized = 0;
+}
+
+template<typename ... Ts>
+inline void SystemSet<Ts...>::UpdateStartSystems(const float deltaTime)
+{
+    ForEachOrdered([this, deltaTime]<typename T>(T* system, const size_t index)
+    {
+        if (system->T::GetTickPolicy() != SystemTickPolicy::Variable) return;
+        Measure(index, SystemPhase::UpdateStart, m_startChannels[index], [system, deltaTime] { system->T::OnUpdateStart(deltaTime); });
+    });
+}
+
+template<typename ... Ts>
+inline void SystemSet<Ts...>::UpdateFixedSystems(const float fixedDeltaTime)
+{
+    ForEachOrdered([fixedDeltaTime]<typename T>(T* system, size_t)
+    {
+        if (system->T::GetTickPolicy() == SystemTickPolicy::Fixed) system->T::OnFixedUpdate(fixedDeltaTime);
+    });
+}
+
+template<typename ... Ts>
+inline void SystemSet<Ts...>::InterpolateSystems(const float alpha)
+{
+    ForEachOrdered([alpha]<typename T>(T* system, size_t) { system->T::OnInterpolate(alpha); });
+}
+
+template<typename ... Ts>
+inline void SystemSet<Ts...>::UpdateEndSystems()
+{
+    ForEachOrdered([this]<typename T>(T* system, const size_t index)
+    {
+        Measure(index, SystemPhase::UpdateEnd, m_endChannels[index], [system] { system->T::OnUpdateEnd(); });
+    });
+}
+
+template<typename ... Ts>
+inline void SystemSet<Ts...>::ReleaseSystems()
+{
+    ReleaseInitialized(m_nInitialized);
+}
+
+#endif //SYSTEMSET_H
@@ -0,0 +1,163 @@
+#include "SystemTaskGraph.h"
+#include "Common/DefineWindows.h"
+#include "Engine/JobSystem/JobSystem.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+    struct NODE_ACCESS
+    {
+        SYSTEM_RESOURCE_ACCESS Access;
+        bool                   Exclusive{ true };
+    };
+
+    bool Overlaps(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b)
+    {
+        for (const uint64_t id : a)
+            if (std::ranges::find(b, id) != b.end()) return true;
+        return false;
+    }
+
+    bool Conflicts(const NODE_ACCESS& a, const NODE_ACCESS& b)
+    {
+        if (a.Exclusive || b.Exclusive) return true;
+
+        return Overlaps(a.Access.Writes, b.Access.Writes)
+            || Overlaps(a.Access.Writes, b.Access.Reads)
+            || Overlaps(a.Access.Reads,  b.Access.Writes);
+    }
+}
+
+void SystemTaskGraph::Build(
+    const std::vector<ISystem*>& systems,
+    const std::unordered_map<ISystem*, std::vector<ISystem*>>& dependencies)
+{
+    const uint32_t count = static_cast<uint32_t>(systems.size());
+
+    std::vector<NODE_ACCESS> accesses(count);
+    std::unordered_map<ISystem*, uint32_t> indices;
+
+    m_nodes.assign(count, {});
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        m_nodes[i].System     = systems[i];
+        accesses[i].Exclusive = !systems[i]->DeclareResources(accesses[i].Access);
+        m_nodes[i].MainThread = accesses[i].Exclusive || accesses[i].Access.MainThread;
+        indices.emplace(systems[i], i);
+    }
+
+    //~ edges only point forward in the given order, so declaration order decides who goes first on a conflict
+    m_nEdges = 0;
+    std::vector<uint32_t> level(count, 1);
+    for (uint32_t j = 0; j < count; ++j)
+    {
+        std::vector<uint32_t> before;
+        if (const auto it = dependencies.find(systems[j]); it != dependencies.end())
+        {
+            for (ISystem* dependency : it->second)
+                if (const auto found = indices.find(dependency); found != indices.end() && found->second < j)
+                    before.push_back(found->second);
+        }
+        for (uint32_t i = 0; i < j; ++i)
+            if (Conflicts(accesses[i], accesses[j])) before.push_back(i);
+
+        std::ranges::sort(before);
+        const auto [first, last] = std::ranges::unique(before);
+        before.erase(first, last);
+
+        for (const uint32_t i : before)
+        {
+            m_nodes[i].Successors.push_back(j);
+            level[j] = std::max(level[j], level[i] + 1);
+        }
+        m_nodes[j].Predecessors = static_cast<uint32_t>(before.size());
+        m_nEdges += static_cast<uint32_t>(before.size());
+    }
+    m_nDepth = count ? *std::ranges::max_element(level) : 0;
+
+    m_pPending   = std::make_unique<std::atomic<uint32_t>[]>(count);
+    m_pReadyMain = std::make_unique<std::atomic<uint32_t>[]>(count);
+}
+
+void SystemTaskGraph::Dispatch(JobSystem* pJobs, void* context, const TaskThunk thunk)
+{
+    const uint32_t count = static_cast<uint32_t>(m_nodes.size());
+    if (count == 0) return;
+
+    if (pJobs == nullptr || pJobs->GetWorkerCount() == 0)
+    {
+        for (uint32_t i = 0; i < count; ++i) thunk(context, m_nodes[i].System, i);
+        return;
+    }
+
+    m_pJobs    = pJobs;
+    m_pContext = context;
+    m_pThunk   = thunk;
+    m_nMainHead = 0;
+    m_nMainTail.store(0, std::memory_order_relaxed);
+    m_nRemaining.store(count, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        m_pPending  [i].store(m_nodes[i].Predecessors, std::memory_order_relaxed);
+        m_pReadyMain[i].store(EMPTY_SLOT, std::memory_order_relaxed);
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+        if (m_nodes[i].Predecessors == 0) Release(i);
+
+    //~ the main thread runs MainThread nodes as they come up and helps with jobs in between
+    while (m_nRemaining.load(std::memory_order_acquire) != 0)
+    {
+        if (m_nMainHead < m_nMainTail.load(std::memory_order_acquire))
+        {
+            uint32_t index;
+            while ((index = m_pReadyMain[m_nMainHead].load(std::memory_order_acquire)) == EMPTY_SLOT) YieldProcessor();
+
+            ++m_nMainHead;
+            RunNode(index);
+            continue;
+        }
+
+        if (!m_pJobs->ExecuteOne()) YieldProcessor();
+    }
+
+    m_pJobs    = nullptr;
+    m_pContext = nullptr;
+    m_pThunk   = nullptr;
+
+    if (m_error) std::rethrow_exception(std::exchange(m_error, nullptr));
+}
+
+void SystemTaskGraph::Release(const uint32_t index)
+{
+    if (m_nodes[index].MainThread)
+    {
+        const uint32_t slot = m_nMainTail.fetch_add(1, std::memory_order_acq_rel);
+        m_pReadyMain[slot].store(index, std::memory_order_release);
+        return;
+    }
+
+    m_pJobs->Run(m_pJobs->CreateJob([this, index] { RunNode(index); }));
+}
+
+void SystemTaskGraph::RunNode(const uint32_t index)
+{
+    const NODE& node = m_nodes[index];
+    try
+    {
+        m_pThunk(m_pContext, node.System, index);
+    }
+    catch (...)
+    {
+        //~ the rest of the frame still runs, the first error surfaces on the main thread
+        std::scoped_lock lock(m_errorMutex);
+        if (!m_error) m_error = std::current_exception();
+    }
+
+    for (const uint32_t successor : node.Successors)
+        if (m_pPending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) Release(successor);
+
+    m_nRemaining.fetch_sub(1, std::memory_order_release);
+}
@@ -0,0 +1,92 @@
+#ifndef SYSTEMTASKGRAPH_H
+#define SYSTEMTASKGRAPH_H
+
+#include "Common/Core.h"
+#include "Interface/ISystem.h"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+class JobSystem;
+
+/**
+ * @brief Per-frame DAG over the registered systems. An edge orders two systems when one depends on
+ *        the other or their declared resources conflict (write/write, read/write), everything else
+ *        runs concurrently as jobs. Built once per registration change, executing a frame never allocates.
+ */
+class SystemTaskGraph
+{
+public:
+     SystemTaskGraph() = default;
+    ~SystemTaskGraph() = default;
+
+    SystemTaskGraph(const SystemTaskGraph&)            = delete;
+    SystemTaskGraph& operator=(const SystemTaskGraph&) = delete;
+
+    //~ systems must already be in dependency order, index i of Execute is systems[i]
+    void Build(
+        _fox_In_ const std::vector<ISystem*>& systems,
+        _fox_In_ const std::unordered_map<ISystem*, std::vector<ISystem*>>& dependencies);
+
+    //~ task(ISystem*, uint32_t index) once per node, blocks until the frame is done. Main thread only.
+    //~ Without a job system (or with no workers) nodes simply run in order on the calling thread.
+    template<typename Fn>
+    void Execute(JobSystem* pJobs, Fn&& task);
+
+    _fox_Return_enforce uint32_t GetNodeCount() const { return static_cast<uint32_t>(m_nodes.size()); }
+    _fox_Return_enforce uint32_t GetEdgeCount() const { return m_nEdges; }
+    _fox_Return_enforce uint32_t GetDepth    () const { return m_nDepth; } // longest chain, 1 is fully parallel
+
+private:
+    using TaskThunk = void(*)(void* context, ISystem* system, uint32_t index);
+
+    struct NODE
+    {
+        ISystem*              System      { nullptr };
+        std::vector<uint32_t> Successors;
+        uint32_t              Predecessors{ 0 };
+        bool                  MainThread  { false };
+    };
+
+    static constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+
+    void Dispatch(JobSystem* pJobs, void* context, TaskThunk thunk);
+    void Release(uint32_t index);
+    void RunNode(uint32_t index);
+
+private:
+    std::vector<NODE> m_nodes;
+    uint32_t          m_nEdges{ 0 };
+    uint32_t          m_nDepth{ 0 };
+
+    //~ frame state. Each node is released exactly once a frame, so the main thread queue never wraps
+    std::unique_ptr<std::atomic<uint32_t>[]> m_pPending;
+    std::unique_ptr<std::atomic<uint32_t>[]> m_pReadyMain;
+    std::atomic<uint32_t>                    m_nMainTail { 0 };
+    uint32_t                                 m_nMainHead { 0 };
+    std::atomic<uint32_t>                    m_nRemaining{ 0 };
+
+    JobSystem*         m_pJobs   { nullptr };
+    void*              m_pContext{ nullptr };
+    TaskThunk          m_pThunk  { nullptr };
+    std::mutex         m_errorMutex;
+    std::exception_ptr m_error;
+};
+
+template<typename Fn>
+inline void SystemTaskGraph::Execute(JobSystem* pJobs, Fn&& task)
+{
+    //~ type erased by hand, a std::function here could allocate every frame
+    using Task = std::remove_reference_t<Fn>;
+    Dispatch(pJobs, const_cast<void*>(static_cast<const void*>(&task)), [](void* context, ISystem* system, const uint32_t index)
+    {
+        (*static_cast<Task*>(context))(system, index);
+    });
+}
+
+#endif //SYSTEMTASKGRAPH_H
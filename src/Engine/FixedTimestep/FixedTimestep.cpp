@@ -0,0 +1,40 @@
+#include "FixedTimestep.h"
+
+#include <algorithm>
+#include <cmath>
+
+FixedTimestep::FixedTimestep(const FIXED_TIMESTEP_DESC& desc)
+    : m_desc(desc)
+{
+    m_desc.StepSeconds      = std::max(m_desc.StepSeconds, 1e-4f);
+    m_desc.MaxStepsPerFrame = std::max(m_desc.MaxStepsPerFrame, 1u);
+}
+
+uint32_t FixedTimestep::Advance(const float frameSeconds)
+{
+    m_fAccumulator += std::max(frameSeconds, 0.0f);
+
+    uint32_t steps = 0;
+    while (m_fAccumulator >= m_desc.StepSeconds && steps < m_desc.MaxStepsPerFrame)
+    {
+        m_fAccumulator -= m_desc.StepSeconds;
+        ++steps;
+    }
+
+    //~ still behind after the cap (breakpoint, window drag, hitch): let simulated time slip rather than catch up
+    if (m_fAccumulator >= m_desc.StepSeconds)
+    {
+        m_fAccumulator = std::fmod(m_fAccumulator, m_desc.StepSeconds);
+        ++m_nDroppedFrames;
+    }
+
+    m_nSteps += steps;
+    return steps;
+}
+
+void FixedTimestep::Reset()
+{
+    m_fAccumulator   = 0.0f;
+    m_nSteps         = 0;
+    m_nDroppedFrames = 0;
+}
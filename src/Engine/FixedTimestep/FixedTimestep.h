@@ -0,0 +1,40 @@
+#ifndef FIXEDTIMESTEP_H
+#define FIXEDTIMESTEP_H
+
+#include "Common/Core.h"
+
+#include <cstdint>
+
+typedef struct FIXED_TIMESTEP_DESC
+{
+    float    StepSeconds      = 1.0f / 60.0f;
+    uint32_t MaxStepsPerFrame = 5; // past this the backlog is dropped instead of simulated (spiral of death)
+} FIXED_TIMESTEP_DESC;
+
+/**
+ * @brief Accumulator that turns variable frame times into a whole number of constant steps.
+ *        Simulation cost per simulated second stays flat no matter how fast the loop runs.
+ */
+class FixedTimestep
+{
+public:
+    explicit FixedTimestep(const FIXED_TIMESTEP_DESC& desc = {});
+
+    //~ Adds the frame time, returns how many fixed steps to run this frame
+    _fox_Return_enforce uint32_t Advance(float frameSeconds);
+
+    _fox_Return_enforce float    GetStep         () const { return m_desc.StepSeconds; }
+    _fox_Return_enforce float    GetAlpha        () const { return m_fAccumulator / m_desc.StepSeconds; }
+    _fox_Return_enforce uint64_t GetStepCount    () const { return m_nSteps; }
+    _fox_Return_enforce uint64_t GetDroppedFrames() const { return m_nDroppedFrames; }
+
+    void Reset();
+
+private:
+    FIXED_TIMESTEP_DESC m_desc;
+    float               m_fAccumulator  { 0.0f };
+    uint64_t            m_nSteps        { 0 };
+    uint64_t            m_nDroppedFrames{ 0 };
+};
+
+#endif //FIXEDTIMESTEP_H
@@ -6,6 +6,7 @@
 
 #include "WindowsManager/Inputs/KeyboardSingleton.h"
 #include "WindowsManager/Inputs/MouseSingleton.h"
+#include "Timer/FastClock.h"
 
 FoxPlayground::FoxPlayground()
 {
@@ -15,13 +16,64 @@ FoxPlayground::FoxPlayground()
 
 FoxPlayground::~FoxPlayground()
 {
+    // members die in reverse order, the scheduler would go before the workers that post resumes into it
+    m_jobs.Shutdown();
+
+    // reverse of Init: plugins may depend on the core, so they go first. InitializeSystems already unwound whatever failed
+    if (m_bPluginsInitialized) m_resolver.ReleaseSystems();
+    m_coreSystems.ReleaseSystems();
+
+    // only now has every system been through all four phases, earlier the Release rows would read 0 calls
+    m_resolver.GetProfiler().ExportAll();
     m_resolver.Clean();
+
+    m_frameStats.ExportAll();
+    const PERCENTILE_SUMMARY frame = m_frameStats.GetTotalSummary(m_nFrameChannel);
+    LOG_INFO("[FrameStats] CPU frame p50 {:.3f} ms, p99 {:.3f} ms, p99.9 {:.3f} ms, max {:.3f} ms over {} frames",
+        frame.P50, frame.P99, frame.P999, frame.Max, frame.Count);
+
+    const FRAME_PACER_STATS pacing = m_pacer.GetStats();
+    LOG_INFO("[Pacer] {} frames, mean {:.3f} ms, jitter {:.3f} ms, worst {:.3f} ms, {:.2f}% deadlines missed",
+        pacing.Frames, pacing.MeanFrameMs, pacing.JitterMs, pacing.WorstFrameMs, pacing.MissRate * 100.0);
+
+    LOG_INFO("[FixedStep] {} steps, {} frames dropped simulated time",
+        m_fixedStep.GetStepCount(), m_fixedStep.GetDroppedFrames());
+
+    // a whole session is the best drift check we get for free
+    if (FastClock::IsTscInvariant())
+        LOG_INFO("[Clock] TSC at {} Hz drifted {:.3f} ppm from QPC this session",
+            FastClock::GetFrequency(), FastClock::GetDriftPpm());
 }
 
 bool FoxPlayground::Init()
 {
     ConfigureResources();
-    return m_resolver.InitializeSystems();
+
+    m_nFrameChannel = m_frameStats.AddChannel("Frame.CPU");
+    m_resolver.AttachStatistics(&m_frameStats);
+    m_resolver.AttachJobSystem(&m_jobs);
+    m_coreSystems.AttachStatistics(&m_frameStats);
+    m_coreSystems.AttachProfiler(&m_resolver.GetProfiler());
+
+    // a quarter of a 60 Hz frame for any one system, the profiler already backs off on repeat offenders
+    SystemProfiler& profiler = m_resolver.GetProfiler();
+    profiler.SetBudget(SystemPhase::UpdateStart, 4.0);
+    profiler.SetBudget(SystemPhase::UpdateEnd,   4.0);
+    profiler.SetBudgetCallback([](const SYSTEM_BUDGET_EVENT& event)
+    {
+        LOG_WARNING("[SystemProfiler] {} {} took {:.3f} ms, budget {:.3f} ms ({} overrun(s))",
+            event.Name, SystemProfiler::GetPhaseName(event.Phase), event.Milliseconds, event.BudgetMilliseconds, event.Overruns);
+    });
+
+    // core first, plugins may depend on it
+    if (!m_coreSystems.InitializeSystems()) return false;
+    if (!m_resolver.InitializeSystems())
+    {
+        m_coreSystems.ReleaseSystems();
+        return false;
+    }
+    m_bPluginsInitialized = true;
+    return true;
 }
 
 int FoxPlayground::Execute()
@@ -30,28 +82,51 @@ int FoxPlayground::Execute()
     while (true)
     {
         m_timer.Tick();
+        const uint64_t frameStart = FastClock::Now();
         if (const auto exitCode = WindowsManager::ProcessMessages()) return *exitCode;
 
-        m_resolver.UpdateStartSystems(m_timer.GetDeltaTime());
+        // coroutines that finished waiting (main thread hops, fences, file reads) continue from here
+        m_coroutines.Pump();
+
+        const float deltaTime = m_timer.GetDeltaTime();
+
+        // fixed systems see a constant step, variable ones the real frame time, renderers blend with alpha
+        const uint32_t fixedSteps = m_fixedStep.Advance(deltaTime);
+        for (uint32_t step = 0; step < fixedSteps; ++step)
+        {
+            m_coreSystems.UpdateFixedSystems(m_fixedStep.GetStep());
+            m_resolver   .UpdateFixedSystems(m_fixedStep.GetStep());
+        }
+
+        m_coreSystems.UpdateStartSystems(deltaTime);
+        m_resolver   .UpdateStartSystems(deltaTime);
+        m_coreSystems.InterpolateSystems(m_fixedStep.GetAlpha());
+        m_resolver   .InterpolateSystems(m_fixedStep.GetAlpha());
 
 #if defined(DEBUG) || defined(_DEBUG)
-        KeyboardSingleton::Get().DebugKeysPressed();
+        // 256 key probes + GetKeyNameText per frame, only worth it if someone reads the output
+        if (LOG_ENABLED(Input, Info)) KeyboardSingleton::Get().DebugKeysPressed();
         // MouseSingleton::Get().DebugKeysPressed();
 
         const float elapsed = m_timer.GetElapsedTime();
         m_pWindowsManager->AddOnWindowsTitle(ToFString(elapsed));
 #endif
 
-        m_resolver.UpdateEndSystems();
-        Sleep(1);
+        m_coreSystems.UpdateEndSystems();
+        m_resolver   .UpdateEndSystems();
+
+        // CPU cost only, the pacer wait is idle time and would bury the spikes
+        m_frameStats.RecordTicks(m_nFrameChannel, FastClock::Now() - frameStart);
+        m_frameStats.EndFrame();
+
+        m_pacer.WaitForNextFrame();
     }
 }
 
 void FoxPlayground::ConfigureResources()
 {
-    //~ Configure Dependencies
-    m_resolver.Register(m_pRenderManager.get(), m_pWindowsManager.get());
-    m_resolver.AddDependency(m_pRenderManager.get(), m_pWindowsManager.get());
+    //~ Core systems, their order comes from SystemDependencies (RenderManager::Dependencies)
+    m_coreSystems.Bind(m_pWindowsManager.get(), m_pRenderManager.get());
 
     m_timer.Reset();
 }
@@ -6,7 +6,13 @@
 #define FOXPLAYGROUND_H
 #include <memory>
 
+#include "Coroutines/CoroutineScheduler.h"
 #include "DependencyResolver/DependencyResolver.h"
+#include "DependencyResolver/SystemSet.h"
+#include "FixedTimestep/FixedTimestep.h"
+#include "FramePacer/FramePacer.h"
+#include "JobSystem/JobSystem.h"
+#include "Profiling/FrameStatistics.h"
 #include "RenderManager/RenderManager.h"
 #include "WindowsManager/WindowsManager.h"
 #include "Timer/Timer.h"
@@ -25,8 +31,16 @@ private:
     void ConfigureResources();
 
 private:
-    DependencyResolver m_resolver{};
+    JobSystem          m_jobs{};     // first in, last out: the resolver's update graph runs on it
+    CoroutineScheduler m_coroutines{ m_jobs };
+    DependencyResolver m_resolver{};     // plugins, registered at runtime
+    SystemSet<WindowsManager, RenderManager> m_coreSystems{}; // ordered and dispatched at compile time
     Timer<float>       m_timer{};
+    FramePacer         m_pacer{};
+    FixedTimestep      m_fixedStep{};
+    FrameStatistics    m_frameStats{};
+    uint32_t           m_nFrameChannel{ FrameStatistics::INVALID_CHANNEL };
+    bool               m_bPluginsInitialized{ false }; // the resolver releases every registered system, only do it once they are up
 
     std::unique_ptr<WindowsManager> m_pWindowsManager{ nullptr };
     std::unique_ptr<RenderManager>  m_pRenderManager { nullptr };
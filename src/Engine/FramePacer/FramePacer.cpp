@@ -0,0 +1,112 @@
+#include "FramePacer.h"
+#include "Timer/FastClock.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+FramePacer::FramePacer(const FRAME_PACER_DESC& desc)
+{
+    //~ high resolution timers exist since Windows 10 1803, older systems get the coarse one and spin more
+    m_hTimer = CreateWaitableTimerEx(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    m_bHighResTimer = m_hTimer != nullptr;
+    if (!m_hTimer) m_hTimer = CreateWaitableTimerEx(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+
+    const double spinMs = m_bHighResTimer ? desc.SpinMarginMs : std::max(desc.SpinMarginMs, 16.0);
+    m_nSpinTicks = static_cast<uint64_t>(spinMs * 1e-3 * static_cast<double>(FastClock::GetFrequency()));
+
+    SetTargetRate(desc.TargetHz);
+}
+
+FramePacer::~FramePacer()
+{
+    if (m_hTimer) CloseHandle(m_hTimer);
+}
+
+void FramePacer::SetTargetRate(const double hz)
+{
+    m_nPeriodTicks = hz > 0.0 ? static_cast<uint64_t>(static_cast<double>(FastClock::GetFrequency()) / hz) : 0;
+    m_nDeadline    = 0;
+}
+
+void FramePacer::WaitForNextFrame()
+{
+    if (m_nPeriodTicks != 0 && m_nDeadline != 0)
+    {
+        const uint64_t now = FastClock::Now();
+        if (now < m_nDeadline)
+        {
+            SleepUntil(m_nDeadline);
+        }
+        else
+        {
+            ++m_nMissed;
+
+            //~ more than a frame behind, re-anchor instead of rushing the next frames to catch up
+            if (now - m_nDeadline > m_nPeriodTicks) m_nDeadline = now;
+        }
+    }
+
+    const uint64_t frameStart = FastClock::Now();
+    if (m_nFrameStart != 0) RecordInterval(frameStart - m_nFrameStart);
+    m_nFrameStart = frameStart;
+
+    //~ deadlines advance by whole periods, a late frame does not push every later one back
+    if (m_nPeriodTicks != 0) m_nDeadline = (m_nDeadline != 0 ? m_nDeadline : frameStart) + m_nPeriodTicks;
+}
+
+FRAME_PACER_STATS FramePacer::GetStats() const
+{
+    FRAME_PACER_STATS stats{};
+    stats.Frames          = m_nFrames;
+    stats.MissedDeadlines = m_nMissed;
+    stats.MissRate        = m_nFrames ? static_cast<double>(m_nMissed) / static_cast<double>(m_nFrames) : 0.0;
+    stats.MeanFrameMs     = m_fMeanMs;
+    stats.JitterMs        = m_nFrames > 1 ? std::sqrt(m_fM2 / static_cast<double>(m_nFrames - 1)) : 0.0;
+    stats.WorstFrameMs    = m_fWorstMs;
+    return stats;
+}
+
+void FramePacer::ResetStats()
+{
+    m_nFrames  = 0;
+    m_nMissed  = 0;
+    m_fMeanMs  = 0.0;
+    m_fM2      = 0.0;
+    m_fWorstMs = 0.0;
+}
+
+void FramePacer::SleepUntil(const uint64_t deadline) const
+{
+    //~ the caller's check is stale if we were preempted since, the subtractions below are unsigned
+    const uint64_t now = FastClock::Now();
+    if (now >= deadline) return;
+
+    // within the spin window the timer is never armed, only the spin below runs
+    if (m_hTimer && deadline - now > m_nSpinTicks)
+    {
+        //~ relative due time, negative and in 100 ns units
+        const double  seconds = FastClock::ToSeconds(deadline - m_nSpinTicks - now);
+        LARGE_INTEGER dueTime{};
+        dueTime.QuadPart = -static_cast<LONGLONG>(seconds * 1e7);
+
+        if (SetWaitableTimerEx(m_hTimer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+            WaitForSingleObject(m_hTimer, INFINITE);
+    }
+
+    while (FastClock::Now() < deadline) YieldProcessor();
+}
+
+void FramePacer::RecordInterval(const uint64_t ticks)
+{
+    const double ms = FastClock::ToMilliseconds(ticks);
+
+    ++m_nFrames;
+    const double delta = ms - m_fMeanMs;
+    m_fMeanMs += delta / static_cast<double>(m_nFrames);
+    m_fM2     += delta * (ms - m_fMeanMs);
+    m_fWorstMs = std::max(m_fWorstMs, ms);
+}
@@ -0,0 +1,67 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include "Common/Core.h"
+#include "Common/DefineWindows.h"
+
+#include <cstdint>
+
+typedef struct FRAME_PACER_DESC
+{
+    double TargetHz     = 144.0; // 0 runs unlimited, WaitForNextFrame only records stats
+    double SpinMarginMs = 1.0;   // the timer wakes this early, the rest is spun for precision
+} FRAME_PACER_DESC;
+
+typedef struct FRAME_PACER_STATS
+{
+    uint64_t Frames         { 0 };
+    uint64_t MissedDeadlines{ 0 };
+    double   MissRate       { 0.0 }; // MissedDeadlines / Frames
+    double   MeanFrameMs    { 0.0 };
+    double   JitterMs       { 0.0 }; // standard deviation of the frame-to-frame interval
+    double   WorstFrameMs   { 0.0 };
+} FRAME_PACER_STATS;
+
+/**
+ * @brief Holds the main loop to a target rate. Sleeps on a high resolution waitable timer until
+ *        shortly before the deadline, then spins the remainder, so the OS timer granularity
+ *        (up to 15.6 ms for Sleep) never shows up as frame time. Main thread only.
+ */
+class FramePacer
+{
+public:
+    explicit FramePacer(const FRAME_PACER_DESC& desc = {});
+    ~FramePacer();
+
+    FramePacer(const FramePacer&)            = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+
+    void SetTargetRate(double hz);
+
+    //~ Call once per frame, blocks until the next deadline
+    void WaitForNextFrame();
+
+    _fox_Return_enforce FRAME_PACER_STATS GetStats() const;
+    void ResetStats();
+
+private:
+    void SleepUntil(uint64_t deadline) const;
+    void RecordInterval(uint64_t ticks);
+
+private:
+    HANDLE   m_hTimer       { nullptr };
+    bool     m_bHighResTimer{ false };
+    uint64_t m_nPeriodTicks { 0 };
+    uint64_t m_nSpinTicks   { 0 };
+    uint64_t m_nDeadline    { 0 };
+    uint64_t m_nFrameStart  { 0 };
+
+    //~ Welford running mean/variance of the interval, in milliseconds
+    uint64_t m_nFrames   { 0 };
+    uint64_t m_nMissed   { 0 };
+    double   m_fMeanMs   { 0.0 };
+    double   m_fM2       { 0.0 };
+    double   m_fWorstMs  { 0.0 };
+};
+
+#endif //FRAMEPACER_H
@@ -0,0 +1,266 @@
+#include "JobSystem.h"
+#include "Common/DefineWindows.h"
+#include "ExceptionHandler/IException.h"
+#include "Logger/Logger.h"
+
+#include <bit>
+
+JobSystem::JobSystem(const JOB_SYSTEM_DESC& desc)
+{
+    const uint32_t hardware = std::max(std::thread::hardware_concurrency(), 1u);
+    const uint32_t workers  = desc.WorkerCount == UINT32_MAX ? hardware - 1 : desc.WorkerCount;
+    const uint32_t capacity = std::bit_ceil(std::max(desc.JobsPerThread, 64u));
+
+    m_nPoolMask  = capacity - 1;
+    m_nSpinCount = std::max(desc.SpinCount, 1u);
+
+    m_threads.reserve(workers + 1);
+    for (uint32_t i = 0; i <= workers; ++i) m_threads.emplace_back(std::make_unique<THREAD_STATE>(capacity, i));
+
+    m_pOwner       = this;
+    m_nThreadIndex = 0;
+
+    m_workers.reserve(workers);
+    for (uint32_t i = 1; i <= workers; ++i) m_workers.emplace_back([this, i] { WorkerLoop(i); });
+
+    LOG_INFO("[JobSystem] {} worker(s), {} jobs per thread", workers, capacity);
+}
+
+JobSystem::~JobSystem()
+{
+    Shutdown();
+    if (m_pOwner == this) m_pOwner = nullptr;
+}
+
+void JobSystem::Shutdown()
+{
+    if (!m_bRunning.exchange(false, std::memory_order_relaxed)) return;
+
+    m_nWakeEpoch.fetch_add(1, std::memory_order_release);
+    WakeByAddressAll(&m_nWakeEpoch);
+    m_workers.clear();
+}
+
+void JobSystem::Run(JOB* job)
+{
+    //~ a full deque means the pool is about to wrap anyway, running inline keeps things correct
+    if (!Self().Queue.Push(job))
+    {
+        Execute(job);
+        return;
+    }
+
+    WakeSleeper();
+}
+
+void JobSystem::PostToWorker(void (*callback)(void*), void* context)
+{
+    {
+        std::scoped_lock lock(m_postMutex);
+        m_posted.push_back({ callback, context });
+        m_nPosted.fetch_add(1, std::memory_order_relaxed);
+    }
+    WakeSleeper();
+}
+
+uint32_t JobSystem::RunPostedCalls()
+{
+    const uint32_t pending = m_nPosted.load(std::memory_order_relaxed);
+
+    uint32_t ran = 0;
+    while (ran < pending && RunPosted()) ++ran;
+    return ran;
+}
+
+void JobSystem::Wait(const JOB* job)
+{
+    uint32_t idle = 0;
+    while (!IsDone(job))
+    {
+        if (ExecuteOne())
+        {
+            idle = 0;
+            continue;
+        }
+
+        //~ the job we wait on is running somewhere else, stay responsive but give the core back eventually
+        if (++idle < m_nSpinCount) YieldProcessor();
+        else SwitchToThread();
+    }
+}
+
+bool JobSystem::ExecuteOne()
+{
+    if (JOB* job = FindJob(Self()))
+    {
+        Execute(job);
+        return true;
+    }
+
+    //~ with no workers, posted calls would otherwise never run
+    return (m_nThreadIndex != 0 || m_workers.empty()) && RunPosted();
+}
+
+JOB* JobSystem::Allocate(const JobFunction function, JOB* parent)
+{
+    THREAD_STATE& self = Self();
+    JOB* job = &self.Pool[self.Allocated++ & m_nPoolMask];
+    if (!IsDone(job)) job = ReclaimSlot(self, job);
+
+    job->Function = function;
+    job->Parent   = parent;
+    job->Unfinished.store(1, std::memory_order_relaxed);
+
+    if (parent) parent->Unfinished.fetch_add(1, std::memory_order_relaxed);
+    return job;
+}
+
+JOB* JobSystem::ReclaimSlot(THREAD_STATE& self, JOB* job)
+{
+    //~ the ring wrapped onto a job still in flight, overwriting it would corrupt whoever waits on it
+    if (!m_bWrapReported.exchange(true, std::memory_order_relaxed))
+        LOG_WARNING("[JobSystem] Thread {} wrapped its job pool onto a live job, helping until slots free. Raise JobsPerThread ({})",
+            self.Index, m_nPoolMask + 1);
+
+    uint32_t skipped = 0;
+    while (!IsDone(job))
+    {
+        // running queued work is what frees slots
+        if (ExecuteOne()) continue;
+
+        // nothing runnable here: the job runs elsewhere or was not Run yet (a parent still adding children), try the next
+        if (++skipped > m_nPoolMask)
+        {
+            SwitchToThread();
+            skipped = 0;
+        }
+        job = &self.Pool[self.Allocated++ & m_nPoolMask];
+    }
+    return job;
+}
+
+JobSystem::THREAD_STATE& JobSystem::Self() const
+{
+    if (m_pOwner != this) THROW_EXCEPTION_MSG("JobSystem used from a thread it does not own.");
+    return *m_threads[m_nThreadIndex];
+}
+
+JOB* JobSystem::FindJob(THREAD_STATE& self) const
+{
+    if (JOB* job = self.Queue.Pop()) return job;
+
+    const uint32_t count = static_cast<uint32_t>(m_threads.size());
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const uint32_t victim = (self.Victim + i) % count;
+        if (victim == self.Index) continue;
+
+        if (JOB* job = m_threads[victim]->Queue.Steal())
+        {
+            self.Victim = victim;
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+bool JobSystem::RunPosted()
+{
+    if (m_nPosted.load(std::memory_order_relaxed) == 0) return false;
+
+    POSTED_CALL call;
+    {
+        std::scoped_lock lock(m_postMutex);
+        if (m_posted.empty()) return false;
+
+        call = m_posted.front();
+        m_posted.pop_front();
+        m_nPosted.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    call.Callback(call.Context);
+    return true;
+}
+
+void JobSystem::WakeSleeper()
+{
+    //~ pairs with the fence in Park: either a sleeper sees the work or we see the sleeper
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_nSleepers.load(std::memory_order_relaxed) != 0)
+    {
+        m_nWakeEpoch.fetch_add(1, std::memory_order_release);
+        WakeByAddressSingle(&m_nWakeEpoch);
+    }
+}
+
+void JobSystem::Execute(JOB* job)
+{
+    job->Function(job);
+    Finish(job);
+}
+
+void JobSystem::Finish(JOB* job)
+{
+    //~ walks up while each level was the last thing its parent waited on
+    while (job)
+    {
+        // once Unfinished hits 0 the slot can be reallocated, so Parent is read before the decrement
+        JOB* parent = job->Parent;
+        if (job->Unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        job = parent;
+    }
+}
+
+void JobSystem::WorkerLoop(const uint32_t index)
+{
+    m_pOwner       = this;
+    m_nThreadIndex = index;
+
+    THREAD_STATE& self = *m_threads[index];
+    uint32_t idle = 0;
+    while (m_bRunning.load(std::memory_order_relaxed))
+    {
+        if (JOB* job = FindJob(self))
+        {
+            Execute(job);
+            idle = 0;
+            continue;
+        }
+        if (RunPosted())
+        {
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < m_nSpinCount) YieldProcessor();
+        else
+        {
+            Park(self);
+            idle = 0;
+        }
+    }
+}
+
+void JobSystem::Park(THREAD_STATE& self)
+{
+    uint32_t epoch = m_nWakeEpoch.load(std::memory_order_acquire);
+    m_nSleepers.fetch_add(1, std::memory_order_seq_cst);
+
+    //~ a job pushed before we counted ourselves skipped the wake, look once more before sleeping
+    if (JOB* job = FindJob(self))
+    {
+        m_nSleepers.fetch_sub(1, std::memory_order_relaxed);
+        Execute(job);
+        return;
+    }
+    if (m_nPosted.load(std::memory_order_relaxed) != 0)
+    {
+        m_nSleepers.fetch_sub(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (m_bRunning.load(std::memory_order_relaxed))
+        WaitOnAddress(&m_nWakeEpoch, &epoch, sizeof(epoch), INFINITE);
+
+    m_nSleepers.fetch_sub(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,197 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include "Common/Core.h"
+#include "WorkStealingDeque.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+struct JOB;
+using JobFunction = void(*)(JOB* job);
+
+//~ One cache line pair, the capture lives inline so creating a job never touches the heap
+typedef struct alignas(64) JOB
+{
+    static constexpr size_t PAYLOAD_SIZE = 96;
+
+    JobFunction           Function  { nullptr };
+    JOB*                  Parent    { nullptr };
+    std::atomic<int32_t>  Unfinished{ 0 };       // itself plus every child not done yet
+    alignas(16) std::byte Payload[PAYLOAD_SIZE];
+} JOB;
+
+static_assert(sizeof(JOB) == 128);
+
+typedef struct JOB_SYSTEM_DESC
+{
+    uint32_t WorkerCount   = UINT32_MAX; // UINT32_MAX: hardware threads - 1, the creating thread is the last one
+    uint32_t JobsPerThread = 4096;       // jobs a thread may have in flight at once, rounded to a power of two, past that Allocate helps until slots free
+    uint32_t SpinCount     = 128;        // empty steal rounds before a worker parks
+} JOB_SYSTEM_DESC;
+
+/**
+ * @brief Work-stealing job system. Every thread owns a Chase-Lev deque and a ring of jobs it allocates
+ *        from without locking; idle threads steal, then park on WaitOnAddress. A job finishes once it
+ *        and all of its children have run, Wait helps with other jobs in the meantime.
+ *        Jobs may only be created and run from the creating thread and the workers.
+ */
+class JobSystem
+{
+public:
+    explicit JobSystem(const JOB_SYSTEM_DESC& desc = {});
+    ~JobSystem();
+
+    JobSystem(const JobSystem&)            = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    //~ Joins the workers, idempotent. Call it before tearing down anything a worker may still call into
+    //~ (posted coroutine resumes); afterwards queued jobs and posted calls only run on the creating thread.
+    void Shutdown();
+
+    template<typename Fn> _fox_Return_enforce JOB* CreateJob     (Fn&& fn);
+    template<typename Fn> _fox_Return_enforce JOB* CreateChildJob(_fox_In_ JOB* parent, Fn&& fn);
+
+    void Run (_fox_In_ JOB* job);
+    void Wait(_fox_In_ const JOB* job);
+
+    //~ fn(uint32_t begin, uint32_t end) over [0, count), grain 0 picks ~4 chunks per thread
+    template<typename Fn>
+    void ParallelFor(uint32_t count, Fn&& fn, uint32_t grain = 0);
+
+    //~ Runs one queued job on the calling thread, false when there was nothing to take
+    _fox_Return_enforce bool ExecuteOne();
+
+    //~ Any thread, owned or not. callback(context) runs on a worker, never on the creating thread
+    //~ unless there are no workers at all. Locked, meant for hand-offs (coroutine resumes), not fine-grained work.
+    void PostToWorker(void (*callback)(void*), void* context);
+
+    //~ Runs the calls posted so far on the calling thread, for owners that pump a job system without workers.
+    //~ Calls posted while it runs wait for the next round, a call that re-posts itself can't spin it forever
+    uint32_t RunPostedCalls();
+
+    _fox_Return_enforce static bool IsDone(const JOB* job) { return job->Unfinished.load(std::memory_order_acquire) == 0; }
+
+    _fox_Return_enforce uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_threads.size()); }
+    _fox_Return_enforce uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_workers.size()); }
+    _fox_Return_enforce bool     IsJobThread   () const { return m_pOwner == this; }
+
+private:
+    struct alignas(64) THREAD_STATE
+    {
+        explicit THREAD_STATE(const uint32_t capacity, const uint32_t index)
+            : Queue(capacity), Pool(std::make_unique<JOB[]>(capacity)), Index(index), Victim(index) {}
+
+        WorkStealingDeque<JOB> Queue;
+        std::unique_ptr<JOB[]> Pool;
+        uint32_t               Allocated{ 0 };
+        uint32_t               Index;
+        uint32_t               Victim;    // last successful steal, tried first next time
+    };
+
+    template<typename Fn> JOB* Emplace(JOB* parent, Fn&& fn);
+    _fox_Return_enforce JOB* Allocate(JobFunction function, JOB* parent);
+    _fox_Return_enforce JOB* ReclaimSlot(THREAD_STATE& self, JOB* job);
+
+    _fox_Return_enforce THREAD_STATE& Self() const;
+    _fox_Return_enforce JOB* FindJob(THREAD_STATE& self) const;
+    _fox_Return_enforce bool RunPosted();
+    void WakeSleeper();
+
+    static void Execute(JOB* job);
+    static void Finish (JOB* job);
+
+    void WorkerLoop(uint32_t index);
+    void Park(THREAD_STATE& self);
+
+private:
+    std::vector<std::unique_ptr<THREAD_STATE>> m_threads; // 0 is the thread that built the system
+    std::vector<std::jthread>                  m_workers;
+    uint32_t                                   m_nPoolMask { 0 };
+    uint32_t                                   m_nSpinCount{ 0 };
+    std::atomic<bool>                          m_bRunning  { true };
+    std::atomic<bool>                          m_bWrapReported{ false };
+
+    struct POSTED_CALL
+    {
+        void (*Callback)(void*);
+        void* Context;
+    };
+
+    std::mutex                                 m_postMutex;
+    std::deque<POSTED_CALL>                    m_posted;
+    std::atomic<uint32_t>                      m_nPosted   { 0 };
+
+    //~ parking: sleepers wait on the epoch, producers only bump it when someone is asleep
+    alignas(64) std::atomic<uint32_t> m_nWakeEpoch{ 0 };
+    alignas(64) std::atomic<uint32_t> m_nSleepers { 0 };
+
+    inline static thread_local JobSystem* m_pOwner       { nullptr };
+    inline static thread_local uint32_t   m_nThreadIndex { 0 };
+};
+
+template<typename Fn>
+inline JOB* JobSystem::CreateJob(Fn&& fn)
+{
+    return Emplace(nullptr, std::forward<Fn>(fn));
+}
+
+template<typename Fn>
+inline JOB* JobSystem::CreateChildJob(JOB* parent, Fn&& fn)
+{
+    return Emplace(parent, std::forward<Fn>(fn));
+}
+
+template<typename Fn>
+inline JOB* JobSystem::Emplace(JOB* parent, Fn&& fn)
+{
+    using Task = std::decay_t<Fn>;
+    static_assert(sizeof(Task)  <= JOB::PAYLOAD_SIZE, "Job capture too large, capture a pointer to it instead");
+    static_assert(alignof(Task) <= 16,                "Job capture over-aligned");
+
+    JOB* job = Allocate([](JOB* self)
+    {
+        Task* task = std::launder(reinterpret_cast<Task*>(self->Payload));
+        (*task)();
+        task->~Task();
+    }, parent);
+
+    new (job->Payload) Task(std::forward<Fn>(fn));
+    return job;
+}
+
+template<typename Fn>
+inline void JobSystem::ParallelFor(const uint32_t count, Fn&& fn, uint32_t grain)
+{
+    if (count == 0) return;
+
+    //~ a few chunks per thread leaves stealing room to even out uneven chunks, and never more than half a pool
+    if (grain == 0) grain = count / (GetThreadCount() * 4);
+    grain = std::max({ grain, 1u, count / ((m_nPoolMask + 1) / 2) + 1 });
+
+    if (count <= grain)
+    {
+        fn(0u, count);
+        return;
+    }
+
+    JOB* root = CreateJob([] {});
+    for (uint32_t begin = 0; begin < count; begin += grain)
+    {
+        const uint32_t end = std::min(count, begin + grain);
+        Run(CreateChildJob(root, [&fn, begin, end] { fn(begin, end); }));
+    }
+    Run(root);
+    Wait(root);
+}
+
+#endif //JOBSYSTEM_H
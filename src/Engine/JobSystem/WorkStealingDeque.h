@@ -0,0 +1,92 @@
+#ifndef WORKSTEALINGDEQUE_H
+#define WORKSTEALINGDEQUE_H
+
+#include "Common/Core.h"
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Fixed capacity Chase-Lev deque (Le et al. 2013 memory orders).
+ *        The owner pushes and pops at the bottom (LIFO, cache warm), thieves steal from the top (FIFO).
+ *        No resizing: the job system bounds live jobs per thread to the same capacity.
+ */
+template<typename T>
+class WorkStealingDeque
+{
+public:
+    explicit WorkStealingDeque(const uint32_t capacity)
+        : m_nMask(std::bit_ceil(capacity) - 1)
+        , m_pItems(std::make_unique<std::atomic<T*>[]>(m_nMask + 1))
+    {}
+
+    WorkStealingDeque(const WorkStealingDeque&)            = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    //~ Owner only, false when full
+    _fox_Return_enforce bool Push(T* item)
+    {
+        const int64_t bottom = m_nBottom.load(std::memory_order_relaxed);
+        const int64_t top    = m_nTop.load(std::memory_order_acquire);
+        if (bottom - top > static_cast<int64_t>(m_nMask)) return false;
+
+        m_pItems[bottom & m_nMask].store(item, std::memory_order_relaxed);
+        m_nBottom.store(bottom + 1, std::memory_order_release); // publishes the slot to thieves' acquire load
+        return true;
+    }
+
+    //~ Owner only
+    _fox_Return_enforce T* Pop()
+    {
+        const int64_t bottom = m_nBottom.load(std::memory_order_relaxed) - 1;
+        m_nBottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_nTop.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_nBottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* item = m_pItems[bottom & m_nMask].load(std::memory_order_relaxed);
+        if (top == bottom)
+        {
+            //~ last item, race the thieves for it
+            if (!m_nTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                item = nullptr;
+            m_nBottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    //~ Any thread
+    _fox_Return_enforce T* Steal()
+    {
+        int64_t top = m_nTop.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_nBottom.load(std::memory_order_acquire);
+        if (top >= bottom) return nullptr;
+
+        T* item = m_pItems[top & m_nMask].load(std::memory_order_relaxed);
+        if (!m_nTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+        return item;
+    }
+
+    _fox_Return_enforce bool IsEmpty() const
+    {
+        return m_nTop.load(std::memory_order_acquire) >= m_nBottom.load(std::memory_order_acquire);
+    }
+
+private:
+    //~ top and bottom on separate lines, thieves hammer one and the owner the other
+    alignas(64) std::atomic<int64_t> m_nTop   { 0 };
+    alignas(64) std::atomic<int64_t> m_nBottom{ 0 };
+    const uint64_t                   m_nMask;
+    std::unique_ptr<std::atomic<T*>[]> m_pItems;
+};
+
+#endif //WORKSTEALINGDEQUE_H
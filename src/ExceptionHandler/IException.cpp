@@ -56,9 +56,15 @@ void IException::SaveCrashLog(const std::string& savePath) const
     //~ TODO: Make it dynamic later......
     std::string path = savePath;
     if (not path.ends_with("/")) path += "/";
-    path += "log_" + Logger::GetTimestamp() + ".txt";
+    const std::string stem = path + "log_" + Logger::GetTimestamp();
+
+    // the recorder file is reused by the next run, keep a copy next to the report
+    const std::string recorderPath = stem + ".fxfr";
+    const bool hasHistory = FlightRecorder::SaveSnapshot(recorderPath);
+
     FileSystem fs{};
-    fs.OpenForWrite(path);
+    fs.OpenForWrite(stem + ".txt");
     fs.WritePlainText(GetErrorLog());
+    if (hasHistory) fs.WritePlainText("[Flight Recorder]: " + recorderPath + " (read with flight-reader)");
     fs.Close();
 }
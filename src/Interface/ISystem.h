@@ -7,6 +7,11 @@
 
 #include "Common/Core.h"
 #include "Common/FObject.h"
+#include "Common/Hash.h"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
 
 #define FOX_SYSTEM_GENERATOR(CLASS_NAME)\
 public:\
@@ -16,6 +21,45 @@ public:\
     }
 
 
+//~ Which phase drives a system's simulation
+enum class SystemTickPolicy : uint8_t
+{
+    Variable, // OnUpdateStart once per frame with the real frame time
+    Fixed     // OnFixedUpdate zero or more times per frame with a constant step
+};
+
+//~ What a system touches in OnUpdateStart, systems whose accesses don't conflict update in parallel
+typedef struct SYSTEM_RESOURCE_ACCESS
+{
+    std::vector<uint64_t> Reads;
+    std::vector<uint64_t> Writes;
+    bool                  MainThread{ false }; // thread-bound work still orders by Reads/Writes, but never leaves the main thread
+
+    void Read (const std::string_view name) { Reads .push_back(ResourceId(name)); }
+    void Write(const std::string_view name) { Writes.push_back(ResourceId(name)); }
+
+    //~ FNV-1a, names are only compared when the update graph is rebuilt
+    static constexpr uint64_t ResourceId(const std::string_view name) { return FoxHash::Fnv1a(name); }
+} SYSTEM_RESOURCE_ACCESS;
+
+//~ Compile-time list of system types, see SystemSet
+template<typename... Ts>
+struct SystemList {};
+
+//~ Systems T needs initialised and updated before itself. Reads T::Dependencies when the class declares one,
+//~ specialise it for classes that can't be touched
+template<typename T>
+struct SystemDependencies
+{
+    using Types = SystemList<>;
+};
+
+template<typename T> requires requires { typename T::Dependencies; }
+struct SystemDependencies<T>
+{
+    using Types = typename T::Dependencies;
+};
+
 class NOVTABLE ISystem: public FObject
 {
 public:
@@ -26,6 +70,19 @@ public:
     virtual void OnUpdateEnd  () = 0;
     virtual void OnRelease    () = 0;
     _fox_Return_enforce virtual FString GetSystemName() const = 0;
+
+    //~ Fixed step opt-in, OnUpdateStart is skipped for Fixed systems
+    _fox_Return_enforce virtual SystemTickPolicy GetTickPolicy() const { return SystemTickPolicy::Variable; }
+    virtual void OnFixedUpdate(float fixedDeltaTime) {}
+
+    //~ Every frame after the fixed steps, alpha is how far the accumulator is into the next step [0, 1)
+    virtual void OnInterpolate(float alpha) {}
+
+    //~ OnInit may run on a worker thread, systems owning thread-bound state (HWND, message queue) pin it here
+    _fox_Return_enforce virtual bool RequiresMainThreadInit() const { return false; }
+
+    //~ Returning false (the default) keeps OnUpdateStart on the main thread, ordered against every other system
+    _fox_Return_enforce virtual bool DeclareResources(SYSTEM_RESOURCE_ACCESS& access) const { return false; }
 };
 
 #endif //ISYSTEM_H
@@ -0,0 +1,182 @@
+#include "FxDebugMessageFilter.h"
+#include "Logger/Logger.h"
+
+#include <algorithm>
+#include <utility>
+
+FxDebugMessageFilter::FxDebugMessageFilter(const FX_DEBUG_FILTER_DESC& desc)
+    : m_desc(desc),
+      m_suppressedIds(desc.SuppressedMessageIds.begin(), desc.SuppressedMessageIds.end())
+{
+    const auto now = Clock::now();
+    const FX_TOKEN_BUCKET_DESC* buckets[] = { &desc.Verbose, &desc.Info, &desc.Warning, &desc.Error };
+    for (size_t i = 0; i < std::size(m_buckets); ++i)
+    {
+        m_buckets[i].Desc       = *buckets[i];
+        m_buckets[i].Tokens     = buckets[i]->Burst;
+        m_buckets[i].LastRefill = now;
+    }
+}
+
+bool FxDebugMessageFilter::Admit(
+    const VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+    const VkDebugUtilsMessengerCallbackDataEXT*  pCallbackData)
+{
+    const int32_t id  = pCallbackData ? pCallbackData->messageIdNumber : 0;
+    const auto    now = Clock::now();
+
+    uint32_t    collapsed   = 0;
+    float       elapsed     = 0.0f;
+    uint64_t    rateLimited = 0;
+    std::string name;
+    {
+        std::scoped_lock lock(m_mutex);
+
+        MESSAGE_STATS& stats = m_stats[id];
+        if (stats.Total++ == 0)
+        {
+            stats.Name     = pCallbackData && pCallbackData->pMessageIdName ? pCallbackData->pMessageIdName : "";
+            stats.Severity = severity;
+        }
+
+        if (m_suppressedIds.contains(id))
+        {
+            ++stats.Filtered;
+            return false;
+        }
+
+        // id 0 is shared by unrelated loader/general messages, never collapse those
+        const auto window = std::chrono::duration<float>(m_desc.RepeatWindowSeconds);
+        if (id != 0 && stats.LastLogged != Clock::time_point{} && now - stats.LastLogged < window)
+        {
+            if (stats.Repeats++ == 0) m_nPending.fetch_add(1, std::memory_order_relaxed);
+            ++stats.Filtered;
+            return false;
+        }
+
+        TOKEN_BUCKET& bucket = m_buckets[SeverityIndex(severity)];
+        if (!TakeToken(bucket, now))
+        {
+            if (bucket.Dropped++ == 0) m_nPending.fetch_add(1, std::memory_order_relaxed);
+            ++stats.Filtered;
+            return false;
+        }
+
+        collapsed = std::exchange(stats.Repeats, 0);
+        if (collapsed)
+        {
+            elapsed = std::chrono::duration<float>(now - stats.LastLogged).count();
+            name    = stats.Name;
+            m_nPending.fetch_sub(1, std::memory_order_relaxed);
+        }
+        stats.LastLogged = now;
+        rateLimited      = std::exchange(bucket.Dropped, 0);
+        if (rateLimited) m_nPending.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // logged outside the lock so callbacks on other threads don't wait on the sinks
+    if (collapsed)
+        LOG_WARNING_CAT(Vulkan, "[VK] {} (0x{:08X}) x{} in last {:.1f}s",
+                                 name, static_cast<uint32_t>(id), collapsed, elapsed);
+    if (rateLimited)
+        LOG_WARNING_CAT(Vulkan, "[VK] {} message(s) dropped by the rate limit", rateLimited);
+    return true;
+}
+
+void FxDebugMessageFilter::Tick()
+{
+    if (m_nPending.load(std::memory_order_relaxed) == 0) return;
+    FlushPending(Clock::now(), /*force=*/false);
+}
+
+void FxDebugMessageFilter::FlushPending(const Clock::time_point now, const bool force)
+{
+    struct PENDING_REPEAT
+    {
+        int32_t     Id;
+        std::string Name;
+        uint32_t    Repeats;
+        float       Elapsed;
+    };
+
+    std::vector<PENDING_REPEAT> repeats;
+    uint64_t rateLimited = 0;
+    {
+        std::scoped_lock lock(m_mutex);
+
+        const auto window = std::chrono::duration<float>(m_desc.RepeatWindowSeconds);
+        for (auto& [id, stats] : m_stats)
+        {
+            if (stats.Repeats == 0 || (!force && now - stats.LastLogged < window)) continue;
+
+            // LastLogged stays, the next occurrence after the window is logged in full
+            repeats.push_back({ id, stats.Name, std::exchange(stats.Repeats, 0),
+                                std::chrono::duration<float>(now - stats.LastLogged).count() });
+            m_nPending.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // drops are already reported on the next admitted message of that severity, only the summary forces them
+        if (force)
+        {
+            for (TOKEN_BUCKET& bucket : m_buckets)
+            {
+                if (bucket.Dropped == 0) continue;
+                rateLimited += std::exchange(bucket.Dropped, 0);
+                m_nPending.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    for (const PENDING_REPEAT& repeat : repeats)
+        LOG_WARNING_CAT(Vulkan, "[VK] {} (0x{:08X}) x{} in last {:.1f}s",
+                                 repeat.Name, static_cast<uint32_t>(repeat.Id), repeat.Repeats, repeat.Elapsed);
+    if (rateLimited)
+        LOG_WARNING_CAT(Vulkan, "[VK] {} message(s) dropped by the rate limit", rateLimited);
+}
+
+void FxDebugMessageFilter::LogSummary()
+{
+    FlushPending(Clock::now(), /*force=*/true);
+
+    std::vector<std::pair<int32_t, MESSAGE_STATS>> hottest;
+    {
+        std::scoped_lock lock(m_mutex);
+        hottest.assign(m_stats.begin(), m_stats.end());
+    }
+    if (hottest.empty()) return;
+
+    const size_t count = std::min<size_t>(m_desc.SummaryTopCount, hottest.size());
+    std::partial_sort(hottest.begin(), hottest.begin() + static_cast<std::ptrdiff_t>(count), hottest.end(),
+                      [](const auto& a, const auto& b) { return a.second.Total > b.second.Total; });
+
+    LOG_SCOPE_GUARD("Validation Message Summary", /*hasNextSibling=*/false);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto& [id, stats] = hottest[i];
+        LOG_INFO_CAT(Vulkan, "0x{:08X} {}: {} total, {} filtered",
+                              static_cast<uint32_t>(id), stats.Name.empty() ? "<unnamed>" : stats.Name,
+                              stats.Total, stats.Filtered);
+    }
+}
+
+size_t FxDebugMessageFilter::SeverityIndex(const VkDebugUtilsMessageSeverityFlagBitsEXT severity)
+{
+    if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT)   return 3;
+    if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) return 2;
+    if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT)    return 1;
+    return 0;
+}
+
+bool FxDebugMessageFilter::TakeToken(TOKEN_BUCKET& bucket, const Clock::time_point now)
+{
+    // a bucket without burst is unlimited
+    if (bucket.Desc.Burst <= 0.0f) return true;
+
+    const float elapsed = std::chrono::duration<float>(now - bucket.LastRefill).count();
+    bucket.Tokens     = std::min(bucket.Desc.Burst, bucket.Tokens + elapsed * bucket.Desc.RatePerSecond);
+    bucket.LastRefill = now;
+
+    if (bucket.Tokens < 1.0f) return false;
+    bucket.Tokens -= 1.0f;
+    return true;
+}
@@ -0,0 +1,93 @@
+#ifndef FXDEBUGMESSAGEFILTER_H
+#define FXDEBUGMESSAGEFILTER_H
+
+#include "Common/DefineVulkan.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+//~ Burst size and refill rate (messages per second) of one severity
+typedef struct FX_TOKEN_BUCKET_DESC
+{
+    float Burst        { 0.0f };
+    float RatePerSecond{ 0.0f };
+} FX_TOKEN_BUCKET_DESC;
+
+/*** Validation message filter config */
+typedef struct FX_DEBUG_FILTER_DESC
+{
+    //~ messageIdNumber values that are counted but never logged
+    std::vector<int32_t> SuppressedMessageIds;
+
+    //~ Repeats of one id inside the window collapse into a single "xN in last Ns" line
+    float RepeatWindowSeconds{ 1.0f };
+
+    FX_TOKEN_BUCKET_DESC Verbose{  20.0f,  10.0f };
+    FX_TOKEN_BUCKET_DESC Info   {  50.0f,  25.0f };
+    FX_TOKEN_BUCKET_DESC Warning{ 100.0f,  50.0f };
+    FX_TOKEN_BUCKET_DESC Error  { 200.0f, 100.0f };
+
+    //~ Hottest ids printed by LogSummary (FxInstance::Release)
+    uint32_t SummaryTopCount{ 10 };
+} FX_DEBUG_FILTER_DESC;
+
+/** Dedup + rate limit in front of the debug messenger callback, keyed on messageIdNumber */
+class FxDebugMessageFilter
+{
+public:
+    explicit FxDebugMessageFilter(_fox_In_ const FX_DEBUG_FILTER_DESC& desc);
+
+    //~ true if the message should reach the log, may emit a collapsed-repeat line first
+    _fox_Return_enforce
+    bool Admit(
+        _fox_In_ VkDebugUtilsMessageSeverityFlagBitsEXT      severity,
+        _fox_In_ const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData);
+
+    //~ Once per frame: reports collapsed repeats whose window ran out without the id coming back
+    void Tick();
+
+    //~ Per-id counters, hottest first, after flushing whatever is still pending
+    void LogSummary();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct MESSAGE_STATS
+    {
+        std::string       Name;
+        uint64_t          Total     { 0 };
+        uint64_t          Filtered  { 0 };  // suppressed, collapsed or rate limited
+        uint32_t          Repeats   { 0 };  // collapsed since the last logged occurrence
+        Clock::time_point LastLogged{};
+        uint32_t          Severity  { 0 };
+    };
+
+    struct TOKEN_BUCKET
+    {
+        FX_TOKEN_BUCKET_DESC Desc{};
+        float                Tokens{ 0.0f };
+        Clock::time_point    LastRefill{};
+        uint64_t             Dropped{ 0 };   // since the last admitted message of this severity
+    };
+
+    static size_t SeverityIndex(VkDebugUtilsMessageSeverityFlagBitsEXT severity);
+    static bool   TakeToken(TOKEN_BUCKET& bucket, Clock::time_point now);
+
+    //~ force ignores the repeat window and also reports rate limit drops (summary time)
+    void FlushPending(Clock::time_point now, bool force);
+
+private:
+    FX_DEBUG_FILTER_DESC                       m_desc;
+    std::unordered_set<int32_t>                m_suppressedIds;
+    std::unordered_map<int32_t, MESSAGE_STATS> m_stats;
+    TOKEN_BUCKET                               m_buckets[4];
+    mutable std::mutex                         m_mutex;
+    std::atomic<uint32_t>                      m_nPending{ 0 }; // ids with Repeats plus buckets with Dropped, lets Tick skip the lock
+};
+
+#endif //FXDEBUGMESSAGEFILTER_H
@@ -16,6 +16,11 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL DebugCallback(
     const VkDebugUtilsMessengerCallbackDataEXT*  pCallbackData,
     void*                                        pUserData)
 {
+    // dedup + rate limit before anything gets formatted
+    if (auto* filter = static_cast<FxDebugMessageFilter*>(pUserData);
+        filter && !filter->Admit(messageSeverity, pCallbackData))
+        return VK_FALSE;
+
     auto typeStr = "";
     if (messageType & VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT)     typeStr = "GENERAL";
     if (messageType & VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT)  typeStr = "VALIDATION";
@@ -24,19 +29,19 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL DebugCallback(
     // Log according to severity
     if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT)
     {
-        LOG_ERROR("[{}][Validation Error] {}", typeStr, pCallbackData->pMessage);
+        LOG_ERROR_CAT(Vulkan, "[{}][Validation Error] {}", typeStr, pCallbackData->pMessage);
     }
     else if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT)
     {
-        LOG_WARNING("[{}][Validation Warning] {}", typeStr, pCallbackData->pMessage);
+        LOG_WARNING_CAT(Vulkan, "[{}][Validation Warning] {}", typeStr, pCallbackData->pMessage);
     }
     else if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT)
     {
-        LOG_INFO("[{}][Validation Info] {}", typeStr, pCallbackData->pMessage);
+        LOG_INFO_CAT(Vulkan, "[{}][Validation Info] {}", typeStr, pCallbackData->pMessage);
     }
     else if (messageSeverity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT)
     {
-        LOG_PRINT("[{}][Validation Verbose] {}", typeStr, pCallbackData->pMessage);
+        LOG_PRINT_CAT(Vulkan, "[{}][Validation Verbose] {}", typeStr, pCallbackData->pMessage);
     }
 
     return VK_FALSE;
@@ -44,52 +49,48 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL DebugCallback(
 
 bool FxInstance::Init()
 {
-    LOG_SCOPE("FxInstance Init", /*hasNextSibling=*/false);
     {
+        LOG_SCOPE_GUARD("FxInstance Init", /*hasNextSibling=*/false);
         m_pAllocator = m_descInstance.pAllocator;
 
-        LOG_SCOPE("Fill App Info", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Fill App Info", /*hasNextSibling=*/true);
             FillAppInfo(m_descInstance);
-            LOG_SUCCESS("App='{}' v{} | Engine='{}' v{} | API v{}.{}.{}",
-                        m_descInstance.AppName,
-                        m_descInstance.AppVersion,
-                        m_descInstance.EngineName,
-                        m_descInstance.EngineVersion,
-                        VK_VERSION_MAJOR(m_descInstance.ApiVersion),
-                        VK_VERSION_MINOR(m_descInstance.ApiVersion),
-                        VK_VERSION_PATCH(m_descInstance.ApiVersion));
+            LOG_SUCCESS_CAT(Render, "App='{}' v{} | Engine='{}' v{} | API v{}.{}.{}",
+                                     m_descInstance.AppName,
+                                     m_descInstance.AppVersion,
+                                     m_descInstance.EngineName,
+                                     m_descInstance.EngineVersion,
+                                     VK_VERSION_MAJOR(m_descInstance.ApiVersion),
+                                     VK_VERSION_MINOR(m_descInstance.ApiVersion),
+                                     VK_VERSION_PATCH(m_descInstance.ApiVersion));
         }
-        LOG_SCOPE_END();
 
-        LOG_SCOPE("Pick Extensions", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Pick Extensions", /*hasNextSibling=*/true);
             PickExtensions(m_descInstance);
         }
-        LOG_SCOPE_END();
 
-        LOG_SCOPE("Pick Layers", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Pick Layers", /*hasNextSibling=*/true);
             PickLayers(m_descInstance);
         }
-        LOG_SCOPE_END();
 
 #if defined(_DEBUG) || defined(DEBUG)
-        LOG_SCOPE("Prepare Debug Messenger", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Prepare Debug Messenger", /*hasNextSibling=*/true);
             FillDebugMessenger();
-            LOG_SUCCESS("Debug messenger create info prepared");
+            LOG_SUCCESS_CAT(Render, "Debug messenger create info prepared");
         }
-        LOG_SCOPE_END();
 #endif
 
-        LOG_SCOPE("Create VkInstance", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Create VkInstance", /*hasNextSibling=*/true);
             VkInstance instance = VK_NULL_HANDLE;
             const VkResult vr = vkCreateInstance(&m_infoVkInstance, m_pAllocator, &instance);
             if (vr != VK_SUCCESS)
             {
-                LOG_ERROR("vkCreateInstance failed: VkResult={}", static_cast<int>(vr));
+                LOG_ERROR_CAT(Render, "vkCreateInstance failed: VkResult={}", static_cast<int>(vr));
                 THROW_EXCEPTION_MSG("Failed to create Vulkan instance");
             }
 
@@ -102,16 +103,14 @@ bool FxInstance::Init()
                 }
             );
 
-            LOG_SUCCESS("VkInstance created");
+            LOG_SUCCESS_CAT(Render, "VkInstance created");
         }
-        LOG_SCOPE_END();
 
 #if defined(_DEBUG) || defined(DEBUG)
-        LOG_SCOPE("Create Debug Messenger", /*hasNextSibling=*/false);
         {
+            LOG_SCOPE_GUARD("Create Debug Messenger", /*hasNextSibling=*/false);
             CreateDebugMessenger();
         }
-        LOG_SCOPE_END();
 #endif
     }
     return true;
@@ -120,11 +119,14 @@ bool FxInstance::Init()
 
 void FxInstance::Release()
 {
-    LOG_SCOPE("FxInstance Release", /*hasNextSibling=*/false);
     {
+        LOG_SCOPE_GUARD("FxInstance Release", /*hasNextSibling=*/false);
+        if (m_pDebugFilter) m_pDebugFilter->LogSummary();
+
         m_pDebugMessenger.Reset();
         m_pInstance.Reset();
-        LOG_SUCCESS("Destroyed instance and debug messenger (if any)");
+        m_pDebugFilter.reset();
+        LOG_SUCCESS_CAT(Render, "Destroyed instance and debug messenger (if any)");
     }
 }
 
@@ -151,17 +153,47 @@ bool FxInstance::SupportsLayer(const char* layerName) const
 
 void FxInstance::FillDebugMessenger()
 {
+    m_pDebugFilter = std::make_unique<FxDebugMessageFilter>(m_descInstance.DebugFilter);
+
     m_infoDebugMessenger = {};
     m_infoDebugMessenger.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
-    m_infoDebugMessenger.messageSeverity =
-        VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT |
-        VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT |
-        VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    m_infoDebugMessenger.messageSeverity = GetSubscribedSeverities();
     m_infoDebugMessenger.messageType =
         VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT |
         VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
         VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
     m_infoDebugMessenger.pfnUserCallback = DebugCallback;
+    m_infoDebugMessenger.pUserData       = m_pDebugFilter.get();
+}
+
+VkDebugUtilsMessageSeverityFlagsEXT FxInstance::GetSubscribedSeverities() const
+{
+    // don't let the layer build messages the Vulkan category would throw away anyway
+    VkDebugUtilsMessageSeverityFlagsEXT severities = m_descInstance.DebugSeverities;
+    if (!LOG_ENABLED(Vulkan, Print)) severities &= ~VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT;
+    if (!LOG_ENABLED(Vulkan, Info))  severities &= ~VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+    return severities;
+}
+
+void FxInstance::Tick()
+{
+    if (m_pDebugFilter) m_pDebugFilter->Tick();
+}
+
+void FxInstance::SetDebugSeverities(const VkDebugUtilsMessageSeverityFlagsEXT severities)
+{
+    m_descInstance.DebugSeverities = severities;
+
+    // no filter means no messenger yet (or a release build), Init picks the new value up
+    if (!m_pDebugFilter) return;
+
+    // severities are fixed at creation, so resubscribing means a new messenger on the same filter
+    m_infoDebugMessenger.messageSeverity = GetSubscribedSeverities();
+    if (!m_pDebugMessenger.Get()) return;
+
+    m_pDebugMessenger.Reset();
+    CreateDebugMessenger();
+    LOG_INFO_CAT(Render, "Debug messenger severities set to 0x{:X}", m_infoDebugMessenger.messageSeverity);
 }
 
 void FxInstance::CreateDebugMessenger()
@@ -172,7 +204,7 @@ void FxInstance::CreateDebugMessenger()
 
     if (!CreateDebugUtilsMessengerEXT)
     {
-        LOG_WARNING("vkCreateDebugUtilsMessengerEXT not found (extension may be missing)");
+        LOG_WARNING_CAT(Render, "vkCreateDebugUtilsMessengerEXT not found (extension may be missing)");
         return;
     }
 
@@ -183,7 +215,7 @@ void FxInstance::CreateDebugMessenger()
     if (vr != VK_SUCCESS)
         THROW_EXCEPTION_MSG("Failed to create Vulkan debug messenger");
 
-    LOG_SUCCESS("Vulkan debug messenger created");
+    LOG_SUCCESS_CAT(Render, "Vulkan debug messenger created");
 
     m_pDebugMessenger = FxPtr<VkDebugUtilsMessengerEXT>(
         debugger,
@@ -217,7 +249,7 @@ void FxInstance::PickExtensions(const FOX_INSTANCE_CREATE_DESC& desc)
     std::vector<VkExtensionProperties> available(extensionCount);
     vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, available.data());
 
-    LOG_INFO("Instance extensions available: {}", extensionCount);
+    LOG_INFO_CAT(Render, "Instance extensions available: {}", extensionCount);
 
     // Requested extensions
     std::vector<std::string> desiredExtensions {
@@ -239,7 +271,7 @@ void FxInstance::PickExtensions(const FOX_INSTANCE_CREATE_DESC& desc)
         if (extensionMap.contains(extensionName))
         {
             m_ppEnabledExtensionNames.emplace_back(extensionName);
-            LOG_SUCCESS("Enable ext: {}", extensionName);
+            LOG_SUCCESS_CAT(Render, "Enable ext: {}", extensionName);
             extensionMap[extensionName] = true;
         }
     }
@@ -247,11 +279,11 @@ void FxInstance::PickExtensions(const FOX_INSTANCE_CREATE_DESC& desc)
     bool error = false;
     for (const auto& [name, found] : extensionMap)
     {
-        if (!found) { error = true; LOG_ERROR("Missing required ext: {}", name); }
+        if (!found) { error = true; LOG_ERROR_CAT(Render, "Missing required ext: {}", name); }
     }
     if (error) THROW_EXCEPTION_MSG("Required instance extensions not found");
 
-    LOG_SUCCESS("All required instance extensions enabled");
+    LOG_SUCCESS_CAT(Render, "All required instance extensions enabled");
 }
 
 void FxInstance::PickLayers(const FOX_INSTANCE_CREATE_DESC& desc)
@@ -261,7 +293,7 @@ void FxInstance::PickLayers(const FOX_INSTANCE_CREATE_DESC& desc)
     std::vector<VkLayerProperties> available(layerCount);
     vkEnumerateInstanceLayerProperties(&layerCount, available.data());
 
-    LOG_INFO("Instance layers available: {}", layerCount);
+    LOG_INFO_CAT(Render, "Instance layers available: {}", layerCount);
 
     std::vector<std::string> desiredLayers;
 #if defined(_DEBUG) || defined(DEBUG)
@@ -280,7 +312,7 @@ void FxInstance::PickLayers(const FOX_INSTANCE_CREATE_DESC& desc)
         if (layerMap.contains(name))
         {
             m_ppEnabledLayerNames.emplace_back(layer.layerName);
-            LOG_SUCCESS("Enable layer: {}", name);
+            LOG_SUCCESS_CAT(Render, "Enable layer: {}", name);
             layerMap[name] = true;
         }
     }
@@ -288,11 +320,11 @@ void FxInstance::PickLayers(const FOX_INSTANCE_CREATE_DESC& desc)
     bool error = false;
     for (const auto& [name, found] : layerMap)
     {
-        if (!found) { error = true; LOG_ERROR("Missing required layer: {}", name); }
+        if (!found) { error = true; LOG_ERROR_CAT(Render, "Missing required layer: {}", name); }
     }
     if (error) THROW_EXCEPTION_MSG("Required instance layers not found");
 
-    LOG_SUCCESS("All required instance layers enabled");
+    LOG_SUCCESS_CAT(Render, "All required instance layers enabled");
 }
 
 void FxInstance::FillInstanceCreateInfo()
@@ -311,7 +343,7 @@ void FxInstance::FillInstanceCreateInfo()
 #endif
     m_infoVkInstance.flags                   = 0;
 
-    LOG_INFO("InstanceCreateInfo: extCount={}, layerCount={}",
-             m_infoVkInstance.enabledExtensionCount,
-             m_infoVkInstance.enabledLayerCount);
+    LOG_INFO_CAT(Render, "InstanceCreateInfo: extCount={}, layerCount={}",
+                          m_infoVkInstance.enabledExtensionCount,
+                          m_infoVkInstance.enabledLayerCount);
 }
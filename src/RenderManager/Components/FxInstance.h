@@ -6,6 +6,9 @@
 #define FXINSTANCE_H
 #include "Common/FxMemory.h"
 #include "Interface/IGfxObject.h"
+#include "FxDebugMessageFilter.h"
+
+#include <memory>
 
 //~ Configure instance desc
 typedef struct FOX_INSTANCE_CREATE_DESC
@@ -25,6 +28,13 @@ typedef struct FOX_INSTANCE_CREATE_DESC
     bool EnableDebug = false;
 #endif
 
+    //~ Severities the messenger subscribes to, VERBOSE/INFO are dropped here too when the Vulkan log category filters them
+    VkDebugUtilsMessageSeverityFlagsEXT DebugSeverities =
+        VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT |
+        VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT |
+        VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    FX_DEBUG_FILTER_DESC DebugFilter{};
+
     VkAllocationCallbacks* pAllocator = nullptr;
 } FOX_INSTANCE_CREATE_DESC;
 
@@ -46,6 +56,12 @@ public:
     bool SupportsExtension(_fox_In_ const char* extensinName) const;
     bool SupportsLayer    (_fox_In_ const char* layerName)    const;
 
+    //~ Once per frame, lets the debug filter report repeats whose window ran out
+    void Tick();
+
+    //~ Resubscribes a live messenger, the filter and its counters are kept
+    void SetDebugSeverities(_fox_In_ VkDebugUtilsMessageSeverityFlagsEXT severities);
+
     //~ Restrict Copy
     FxInstance(const FxInstance&)            = delete;
     FxInstance& operator=(const FxInstance&) = delete;
@@ -57,6 +73,7 @@ public:
 private:
     void FillDebugMessenger();
     void CreateDebugMessenger();
+    VkDebugUtilsMessageSeverityFlagsEXT GetSubscribedSeverities() const;
 
     void FillAppInfo   (_fox_In_ const FOX_INSTANCE_CREATE_DESC& desc);
     void PickExtensions(_fox_In_ const FOX_INSTANCE_CREATE_DESC& desc);
@@ -66,6 +83,7 @@ private:
 
 private:
     FOX_INSTANCE_CREATE_DESC           m_descInstance;
+    std::unique_ptr<FxDebugMessageFilter> m_pDebugFilter; //~ pUserData of the messenger, outlives the instance
     FxPtr<VkInstance>                  m_pInstance;
     VkApplicationInfo                  m_infoVkApp;
     VkInstanceCreateInfo               m_infoVkInstance;
@@ -52,112 +52,98 @@ void FxPhysicalDevice::SetSurface(const VkSurfaceKHR surface)
 
 bool FxPhysicalDevice::Init()
 {
-    LOG_SCOPE("Physical Device Init", /*hasNextSibling=*/false);
     {
+        LOG_SCOPE_GUARD("Physical Device Init", /*hasNextSibling=*/false);
         // Preconditions
-        LOG_SCOPE("Preconditions", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Preconditions", /*hasNextSibling=*/true);
             if (!m_pInstance)
             {
-                LOG_ERROR("No FxInstance attached");
-                LOG_SCOPE_END();
+                LOG_ERROR_CAT(Render, "No FxInstance attached");
                 return false;
             }
 
             const VkSurfaceKHR surf = m_pSurface.Get();
             if (m_policy.RequireSwapChain && surf == VK_NULL_HANDLE)
             {
-                LOG_ERROR("RequireSwapChain=true but no surface was provided");
-                LOG_SCOPE_END();
+                LOG_ERROR_CAT(Render, "RequireSwapChain=true but no surface was provided");
                 return false;
             }
-            LOG_SUCCESS("Preconditions OK");
+            LOG_SUCCESS_CAT(Render, "Preconditions OK");
         }
-        LOG_SCOPE_END();
 
         // Enumerate devices
-        LOG_SCOPE("Enumerate Physical Devices", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Enumerate Physical Devices", /*hasNextSibling=*/true);
             if (!EnumeratePhysicalDevices())
             {
-                LOG_ERROR("vkEnumeratePhysicalDevices failed");
-                LOG_SCOPE_END();
+                LOG_ERROR_CAT(Render, "vkEnumeratePhysicalDevices failed");
                 return false;
             }
-            LOG_SUCCESS("Enumeration OK ({} device(s))", static_cast<int>(m_ppAllDevices.size()));
+            LOG_SUCCESS_CAT(Render, "Enumeration OK ({} device(s))", static_cast<int>(m_ppAllDevices.size()));
         }
-        LOG_SCOPE_END();
 
         // Pick best device
-        LOG_SCOPE("Pick Best Device", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Pick Best Device", /*hasNextSibling=*/true);
             const int best = PickBestDeviceIndex();
             if (best < 0)
             {
-                LOG_ERROR("No suitable physical device found");
-                LOG_SCOPE_END();
+                LOG_ERROR_CAT(Render, "No suitable physical device found");
                 return false;
             }
 
             const VkPhysicalDevice picked = m_ppAllDevices[static_cast<size_t>(best)];
             m_pPhysicalDevice.Reset(picked, nullptr); // physical device has no destructor
-            LOG_SUCCESS("Selected device index: {}", best);
+            LOG_SUCCESS_CAT(Render, "Selected device index: {}", best);
         }
-        LOG_SCOPE_END();
 
         // Cache basics (props/mem/features/exts)
-        LOG_SCOPE("Cache Device Basics", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Cache Device Basics", /*hasNextSibling=*/true);
             CacheDeviceBasics();
-            LOG_SUCCESS("Cached properties, memory, features, and available extensions");
+            LOG_SUCCESS_CAT(Render, "Cached properties, memory, features, and available extensions");
         }
-        LOG_SCOPE_END();
 
         // Queues
-        LOG_SCOPE("Find Queue Families", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Find Queue Families", /*hasNextSibling=*/true);
             if (!FindQueueFamilies())
             {
-                LOG_ERROR("Required queue families not satisfied");
-                LOG_SCOPE_END();
+                LOG_ERROR_CAT(Render, "Required queue families not satisfied");
                 return false;
             }
-            LOG_SUCCESS("Queues -> G={}, C={}, T={}, P={}",
-                        m_qfIndices.Graphics, m_qfIndices.Compute,
-                        m_qfIndices.Transfer, m_qfIndices.Present);
+            LOG_SUCCESS_CAT(Render, "Queues -> G={}, C={}, T={}, P={}",
+                                     m_qfIndices.Graphics, m_qfIndices.Compute,
+                                     m_qfIndices.Transfer, m_qfIndices.Present);
         }
-        LOG_SCOPE_END();
 
         // Extensions
-        LOG_SCOPE("Resolve Extensions", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Resolve Extensions", /*hasNextSibling=*/true);
             if (!ResolveExtensions())
             {
-                LOG_ERROR("Failed to resolve required/optional device extensions");
-                LOG_SCOPE_END();
+                LOG_ERROR_CAT(Render, "Failed to resolve required/optional device extensions");
                 return false;
             }
-            LOG_SUCCESS("Enabled {} device extension(s)",
-                        static_cast<int>(m_ppEnabledDeviceExtensions.size()));
+            LOG_SUCCESS_CAT(Render, "Enabled {} device extension(s)",
+                                     static_cast<int>(m_ppEnabledDeviceExtensions.size()));
         }
-        LOG_SCOPE_END();
 
         // Core features
-        LOG_SCOPE("Validate Required Core Features", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Validate Required Core Features", /*hasNextSibling=*/true);
             if (!ValidateRequiredCoreFeatures())
             {
-                LOG_ERROR("Device lacks required core features");
-                LOG_SCOPE_END();
+                LOG_ERROR_CAT(Render, "Device lacks required core features");
                 return false;
             }
-            LOG_SUCCESS("All required core features supported");
+            LOG_SUCCESS_CAT(Render, "All required core features supported");
         }
-        LOG_SCOPE_END();
 
         // Present support sanity (if WSI)
-        LOG_SCOPE("Validate Present Support (WSI)", /*hasNextSibling=*/false);
         {
+            LOG_SCOPE_GUARD("Validate Present Support (WSI)", /*hasNextSibling=*/false);
             const VkSurfaceKHR surf = m_pSurface.Get();
             if (m_policy.RequireSwapChain && surf != VK_NULL_HANDLE)
             {
@@ -168,36 +154,33 @@ bool FxPhysicalDevice::Init()
                 vkGetPhysicalDeviceSurfaceSupportKHR(m_pPhysicalDevice.Get(), qIndex, surf, &supported);
                 if (!supported)
                 {
-                    LOG_ERROR("Queue family {} does not support presentation", qIndex);
-                    LOG_SCOPE_END();
+                    LOG_ERROR_CAT(Render, "Queue family {} does not support presentation", qIndex);
                     return false;
                 }
             }
-            LOG_SUCCESS("Present support OK (or not required)");
+            LOG_SUCCESS_CAT(Render, "Present support OK (or not required)");
         }
-        LOG_SCOPE_END();
     }
 
-    LOG_SUCCESS("Physical Device Initialized");
+    LOG_SUCCESS_CAT(Render, "Physical Device Initialized");
     return true;
 }
 
 void FxPhysicalDevice::Release()
 {
-    LOG_SCOPE("Release Physical Device", /*hasNextSibling=*/false);
     {
+        LOG_SCOPE_GUARD("Release Physical Device", /*hasNextSibling=*/false);
         // Reset handles
-        LOG_SCOPE("Reset Handles", /*hasNextSibling=*/true);
         {
+            LOG_SCOPE_GUARD("Reset Handles", /*hasNextSibling=*/true);
             m_pPhysicalDevice.Reset();
             m_pSurface.Reset();
-            LOG_SUCCESS("Handles reset (physical device + surface)");
+            LOG_SUCCESS_CAT(Render, "Handles reset (physical device + surface)");
         }
-        LOG_SCOPE_END();
 
         // Clear cached data
-        LOG_SCOPE("Clear Cached Data", /*hasNextSibling=*/false);
         {
+            LOG_SCOPE_GUARD("Clear Cached Data", /*hasNextSibling=*/false);
             m_props      = {};
             m_memProps   = {};
             m_features2  = {};
@@ -209,12 +192,11 @@ void FxPhysicalDevice::Release()
             m_ppEnabledDeviceExtensions.clear();
             m_ppAllDevices.clear();
 
-            LOG_SUCCESS("All cached properties, features, and device lists cleared");
+            LOG_SUCCESS_CAT(Render, "All cached properties, features, and device lists cleared");
         }
-        LOG_SCOPE_END();
     }
 
-    LOG_SUCCESS("Physical device released");
+    LOG_SUCCESS_CAT(Render, "Physical device released");
 }
 
 VkPhysicalDevice FxPhysicalDevice::Get() const
@@ -283,11 +265,11 @@ bool FxPhysicalDevice::HasExt(const std::vector<VkExtensionProperties>& exts, co
     {
         if (std::strcmp(e.extensionName, name) == 0)
         {
-            LOG_INFO("Extension '{}' found", name);
+            LOG_INFO_CAT(Render, "Extension '{}' found", name);
             return true;
         }
     }
-    LOG_WARNING("Extension '{}' not found", name);
+    LOG_WARNING_CAT(Render, "Extension '{}' not found", name);
     return false;
 }
 
@@ -341,12 +323,12 @@ FxPhysicalDevice& FxPhysicalDevice::operator=(FxPhysicalDevice&& other) noexcept
 
 bool FxPhysicalDevice::EnumeratePhysicalDevices()
 {
-    LOG_INFO("Enumerating Vulkan physical devices...");
+    LOG_INFO_CAT(Render, "Enumerating Vulkan physical devices...");
     LOG_ADD_TAB();
 
     if (!m_pInstance)
     {
-        LOG_ERROR("No FxInstance attached");
+        LOG_ERROR_CAT(Render, "No FxInstance attached");
         LOG_REMOVE_TAB();
         return false;
     }
@@ -357,14 +339,14 @@ bool FxPhysicalDevice::EnumeratePhysicalDevices()
     VkResult vr = vkEnumeratePhysicalDevices(inst, &count, nullptr);
     if (vr != VK_SUCCESS)
     {
-        LOG_ERROR("vkEnumeratePhysicalDevices(count=null) failed: VkResult={}", static_cast<int>(vr));
+        LOG_ERROR_CAT(Render, "vkEnumeratePhysicalDevices(count=null) failed: VkResult={}", static_cast<int>(vr));
         LOG_REMOVE_TAB();
         return false;
     }
 
     if (count == 0)
     {
-        LOG_ERROR("No Vulkan-capable physical devices found");
+        LOG_ERROR_CAT(Render, "No Vulkan-capable physical devices found");
         LOG_REMOVE_TAB();
         return false;
     }
@@ -373,14 +355,14 @@ bool FxPhysicalDevice::EnumeratePhysicalDevices()
     vr = vkEnumeratePhysicalDevices(inst, &count, tmp.data());
     if (vr != VK_SUCCESS)
     {
-        LOG_ERROR("vkEnumeratePhysicalDevices(handles) failed: VkResult={}", static_cast<int>(vr));
+        LOG_ERROR_CAT(Render, "vkEnumeratePhysicalDevices(handles) failed: VkResult={}", static_cast<int>(vr));
         LOG_REMOVE_TAB();
         return false;
     }
 
     m_ppAllDevices.assign(tmp.begin(), tmp.end());
 
-    LOG_SUCCESS("Found {} physical device(s)", static_cast<int>(m_ppAllDevices.size()));
+    LOG_SUCCESS_CAT(Render, "Found {} physical device(s)", static_cast<int>(m_ppAllDevices.size()));
 
     // Log info for each device
     auto typeToStr = [](VkPhysicalDeviceType t) -> const char*
@@ -400,13 +382,13 @@ bool FxPhysicalDevice::EnumeratePhysicalDevices()
     {
         VkPhysicalDeviceProperties props{};
         vkGetPhysicalDeviceProperties(m_ppAllDevices[i], &props);
-        LOG_INFO("[#{}] {} | {} | API {}.{}.{}",
-                 static_cast<int>(i),
-                 props.deviceName,
-                 typeToStr(props.deviceType),
-                 VK_VERSION_MAJOR(props.apiVersion),
-                 VK_VERSION_MINOR(props.apiVersion),
-                 VK_VERSION_PATCH(props.apiVersion));
+        LOG_INFO_CAT(Render, "[#{}] {} | {} | API {}.{}.{}",
+                              static_cast<int>(i),
+                              props.deviceName,
+                              typeToStr(props.deviceType),
+                              VK_VERSION_MAJOR(props.apiVersion),
+                              VK_VERSION_MINOR(props.apiVersion),
+                              VK_VERSION_PATCH(props.apiVersion));
     }
     LOG_REMOVE_TAB();
 
@@ -416,7 +398,7 @@ bool FxPhysicalDevice::EnumeratePhysicalDevices()
 
 int FxPhysicalDevice::PickBestDeviceIndex()
 {
-    LOG_INFO("Scoring physical devices...");
+    LOG_INFO_CAT(Render, "Scoring physical devices...");
     LOG_ADD_TAB();
 
     if (m_ppAllDevices.empty())
@@ -447,11 +429,11 @@ int FxPhysicalDevice::PickBestDeviceIndex()
         VkPhysicalDeviceProperties props{};
         vkGetPhysicalDeviceProperties(pd, &props);
 
-        LOG_INFO("Evaluating [#{}] {} ({}) API {}.{}.{}",
-                 i, props.deviceName, typeToStr(props.deviceType),
-                 VK_VERSION_MAJOR(props.apiVersion),
-                 VK_VERSION_MINOR(props.apiVersion),
-                 VK_VERSION_PATCH(props.apiVersion));
+        LOG_INFO_CAT(Render, "Evaluating [#{}] {} ({}) API {}.{}.{}",
+                              i, props.deviceName, typeToStr(props.deviceType),
+                              VK_VERSION_MAJOR(props.apiVersion),
+                              VK_VERSION_MINOR(props.apiVersion),
+                              VK_VERSION_PATCH(props.apiVersion));
         LOG_ADD_TAB();
 
         // 1) Device type preference
@@ -460,7 +442,7 @@ int FxPhysicalDevice::PickBestDeviceIndex()
                                       props.deviceType) != m_policy.PreferredTypes.end();
         if (!typeOk)
         {
-            LOG_WARNING("Rejected: device type not in preferred list");
+            LOG_WARNING_CAT(Render, "Rejected: device type not in preferred list");
             LOG_REMOVE_TAB();
             cands.push_back({ i, std::numeric_limits<long long>::min(), false });
             continue;
@@ -475,7 +457,7 @@ int FxPhysicalDevice::PickBestDeviceIndex()
 
         if (m_policy.RequireSwapChain && !HasExt(exts, "VK_KHR_swapchain"))
         {
-            LOG_WARNING("Rejected: missing VK_KHR_swapchain (RequireSwapChain=true)");
+            LOG_WARNING_CAT(Render, "Rejected: missing VK_KHR_swapchain (RequireSwapChain=true)");
             LOG_REMOVE_TAB();
             cands.push_back({ i, std::numeric_limits<long long>::min(), false });
             continue;
@@ -486,7 +468,7 @@ int FxPhysicalDevice::PickBestDeviceIndex()
         {
             if (!HasExt(exts, req))
             {
-                LOG_WARNING("Rejected: missing required extension '{}'", req);
+                LOG_WARNING_CAT(Render, "Rejected: missing required extension '{}'", req);
                 missingReqExt = true;
                 break;
             }
@@ -502,14 +484,14 @@ int FxPhysicalDevice::PickBestDeviceIndex()
         FX_QUEUE_FAMILY_INDEX_DESC qfi{};
         if (!ProbeQueueFamilies(pd, qfi))
         {
-            LOG_WARNING("Rejected: no suitable queue families found");
+            LOG_WARNING_CAT(Render, "Rejected: no suitable queue families found");
             LOG_REMOVE_TAB();
             cands.push_back({ i, std::numeric_limits<long long>::min(), false });
             continue;
         }
         if (!qfi.IsValid(m_policy.RequireSwapChain))
         {
-            LOG_WARNING("Rejected: incomplete queues (graphics/present)");
+            LOG_WARNING_CAT(Render, "Rejected: incomplete queues (graphics/present)");
             LOG_REMOVE_TAB();
             cands.push_back({ i, std::numeric_limits<long long>::min(), false });
             continue;
@@ -538,9 +520,9 @@ int FxPhysicalDevice::PickBestDeviceIndex()
         const long long vramMB = static_cast<long long>(bestHeap / (1024ull * 1024ull));
         score += static_cast<long long>(m_policy.WeightVRam) * vramMB;
 
-        LOG_SUCCESS("Accepted: Queues G={}, C={}, T={}, P={} | Score={} (VRAM~{} MB, MaxImage2D={})",
-                    qfi.Graphics, qfi.Compute, qfi.Transfer, qfi.Present,
-                    score, vramMB, props.limits.maxImageDimension2D);
+        LOG_SUCCESS_CAT(Render, "Accepted: Queues G={}, C={}, T={}, P={} | Score={} (VRAM~{} MB, MaxImage2D={})",
+                                 qfi.Graphics, qfi.Compute, qfi.Transfer, qfi.Present,
+                                 score, vramMB, props.limits.maxImageDimension2D);
 
         LOG_REMOVE_TAB();
         cands.push_back({ i, score, true });
@@ -561,7 +543,7 @@ int FxPhysicalDevice::PickBestDeviceIndex()
 
     if (bestIdx < 0) THROW_EXCEPTION_FMT("No suitable physical device found after scoring");
 
-    LOG_SUCCESS("Selected device index {}", bestIdx);
+    LOG_SUCCESS_CAT(Render, "Selected device index {}", bestIdx);
     LOG_REMOVE_TAB();
     return bestIdx;
 }
@@ -604,12 +586,12 @@ void FxPhysicalDevice::CacheDeviceBasics()
         THROW_EXCEPTION_FMT("Failed to enumerate extensions for device '{}'", m_props.deviceName);
     }
 
-    LOG_INFO("Cached properties for physical device '{}'", m_props.deviceName);
+    LOG_INFO_CAT(Render, "Cached properties for physical device '{}'", m_props.deviceName);
 }
 
 bool FxPhysicalDevice::ProbeQueueFamilies(VkPhysicalDevice pd, FX_QUEUE_FAMILY_INDEX_DESC& out) const
 {
-    LOG_PRINT("Probing queue families...");
+    LOG_PRINT_CAT(Render, "Probing queue families...");
     LOG_ADD_TAB();
 
     out = {}; // reset
@@ -618,7 +600,7 @@ bool FxPhysicalDevice::ProbeQueueFamilies(VkPhysicalDevice pd, FX_QUEUE_FAMILY_I
     vkGetPhysicalDeviceQueueFamilyProperties(pd, &count, nullptr);
     if (count == 0)
     {
-        LOG_WARNING("No queue families reported by the device");
+        LOG_WARNING_CAT(Render, "No queue families reported by the device");
         LOG_REMOVE_TAB();
         return false;
     }
@@ -699,12 +681,12 @@ bool FxPhysicalDevice::ProbeQueueFamilies(VkPhysicalDevice pd, FX_QUEUE_FAMILY_I
 
     const bool ok = out.IsValid(m_policy.RequireSwapChain);
 
-    LOG_INFO("Queues -> G={}, C={}, T={}, P={} (requirePresent={})",
-             out.Graphics, out.Compute, out.Transfer, out.Present,
-             m_policy.RequireSwapChain ? "true" : "false");
+    LOG_INFO_CAT(Render, "Queues -> G={}, C={}, T={}, P={} (requirePresent={})",
+                          out.Graphics, out.Compute, out.Transfer, out.Present,
+                          m_policy.RequireSwapChain ? "true" : "false");
 
     if (!ok)
-        LOG_WARNING("Queue families incomplete for current requirements");
+        LOG_WARNING_CAT(Render, "Queue families incomplete for current requirements");
 
     LOG_REMOVE_TAB();
     return ok;
@@ -712,12 +694,12 @@ bool FxPhysicalDevice::ProbeQueueFamilies(VkPhysicalDevice pd, FX_QUEUE_FAMILY_I
 
 bool FxPhysicalDevice::FindQueueFamilies()
 {
-    LOG_INFO("Finding queue families on selected physical device...");
+    LOG_INFO_CAT(Render, "Finding queue families on selected physical device...");
     LOG_ADD_TAB();
 
     if (!m_pPhysicalDevice.IsValid())
     {
-        LOG_ERROR("FindQueueFamilies called before selecting a physical device");
+        LOG_ERROR_CAT(Render, "FindQueueFamilies called before selecting a physical device");
         LOG_REMOVE_TAB();
         THROW_EXCEPTION_FMT("FindQueueFamilies: no physical device selected");
     }
@@ -729,24 +711,24 @@ bool FxPhysicalDevice::FindQueueFamilies()
 
     if (!ok || !qfi.IsValid(m_policy.RequireSwapChain))
     {
-        LOG_ERROR("Required queue families not satisfied (RequireSwapChain={})",
-                  m_policy.RequireSwapChain ? "true" : "false");
+        LOG_ERROR_CAT(Render, "Required queue families not satisfied (RequireSwapChain={})",
+                               m_policy.RequireSwapChain ? "true" : "false");
         LOG_REMOVE_TAB();
         THROW_EXCEPTION_FMT("Selected physical device does not provide required queue families");
     }
 
     m_qfIndices = qfi;
 
-    LOG_SUCCESS("Queues -> G={}, C={}, T={}, P={}",
-                m_qfIndices.Graphics, m_qfIndices.Compute,
-                m_qfIndices.Transfer, m_qfIndices.Present);
+    LOG_SUCCESS_CAT(Render, "Queues -> G={}, C={}, T={}, P={}",
+                             m_qfIndices.Graphics, m_qfIndices.Compute,
+                             m_qfIndices.Transfer, m_qfIndices.Present);
     LOG_REMOVE_TAB();
     return true;
 }
 
 bool FxPhysicalDevice::EnumerateDeviceExtensions(VkPhysicalDevice pd, std::vector<VkExtensionProperties>& out)
 {
-    LOG_PRINT("Enumerating device extensions...");
+    LOG_PRINT_CAT(Render, "Enumerating device extensions...");
     LOG_ADD_TAB();
 
     out.clear();
@@ -755,14 +737,14 @@ bool FxPhysicalDevice::EnumerateDeviceExtensions(VkPhysicalDevice pd, std::vecto
     VkResult vr = vkEnumerateDeviceExtensionProperties(pd, /*pLayerName*/nullptr, &count, nullptr);
     if (vr != VK_SUCCESS)
     {
-        LOG_ERROR("vkEnumerateDeviceExtensionProperties(count=null) failed: VkResult={}", static_cast<int>(vr));
+        LOG_ERROR_CAT(Render, "vkEnumerateDeviceExtensionProperties(count=null) failed: VkResult={}", static_cast<int>(vr));
         LOG_REMOVE_TAB();
         return false;
     }
 
     if (count == 0)
     {
-        LOG_WARNING("Device reports 0 extensions");
+        LOG_WARNING_CAT(Render, "Device reports 0 extensions");
         LOG_REMOVE_TAB();
         return true; // success (empty list)
     }
@@ -771,20 +753,20 @@ bool FxPhysicalDevice::EnumerateDeviceExtensions(VkPhysicalDevice pd, std::vecto
     vr = vkEnumerateDeviceExtensionProperties(pd, nullptr, &count, out.data());
     if (vr != VK_SUCCESS)
     {
-        LOG_ERROR("vkEnumerateDeviceExtensionProperties(handles) failed: VkResult={}", static_cast<int>(vr));
+        LOG_ERROR_CAT(Render, "vkEnumerateDeviceExtensionProperties(handles) failed: VkResult={}", static_cast<int>(vr));
         out.clear();
         LOG_REMOVE_TAB();
         return false;
     }
 
-    LOG_INFO("Found {} device extension(s)", static_cast<int>(out.size()));
+    LOG_INFO_CAT(Render, "Found {} device extension(s)", static_cast<int>(out.size()));
     LOG_REMOVE_TAB();
     return true;
 }
 
 bool FxPhysicalDevice::ResolveExtensions()
 {
-    LOG_PRINT("Resolving required/optional device extensions...");
+    LOG_PRINT_CAT(Render, "Resolving required/optional device extensions...");
     LOG_ADD_TAB();
 
     // m_deviceExtProps must already be cached by CacheDeviceBasics()
@@ -795,7 +777,7 @@ bool FxPhysicalDevice::ResolveExtensions()
     {
         if (!HasExt(m_ppDeviceExtProps, req))
         {
-            LOG_ERROR("Missing required device extension '{}'", req);
+            LOG_ERROR_CAT(Render, "Missing required device extension '{}'", req);
             LOG_REMOVE_TAB();
             THROW_EXCEPTION_FMT("FxPhysicalDevice::ResolveExtensions: missing required extension '{}'", req);
         }
@@ -808,44 +790,44 @@ bool FxPhysicalDevice::ResolveExtensions()
         if (HasExt(m_ppDeviceExtProps, opt))
         {
             m_ppEnabledDeviceExtensions.push_back(opt);
-            LOG_INFO("Enabled optional extension '{}'", opt);
+            LOG_INFO_CAT(Render, "Enabled optional extension '{}'", opt);
         }
     }
 
-    LOG_SUCCESS("Enabled {} device extension(s)", static_cast<int>(m_ppEnabledDeviceExtensions.size()));
+    LOG_SUCCESS_CAT(Render, "Enabled {} device extension(s)", static_cast<int>(m_ppEnabledDeviceExtensions.size()));
     LOG_REMOVE_TAB();
     return true;
 }
 
 bool FxPhysicalDevice::ValidateRequiredCoreFeatures()
 {
-    LOG_PRINT("Validating required core features for '{}'", m_props.deviceName);
+    LOG_PRINT_CAT(Render, "Validating required core features for '{}'", m_props.deviceName);
     LOG_ADD_TAB();
 
     const VkPhysicalDeviceFeatures& f = m_features2.features;
 
     if (m_policy.RequiredCoreFeatures.SampleAnisotropy && !f.samplerAnisotropy)
     {
-        LOG_ERROR("Required feature 'samplerAnisotropy' not supported");
+        LOG_ERROR_CAT(Render, "Required feature 'samplerAnisotropy' not supported");
         LOG_REMOVE_TAB();
         THROW_EXCEPTION_FMT("Device '{}' lacks required feature: samplerAnisotropy", m_props.deviceName);
     }
 
     if (m_policy.RequiredCoreFeatures.GeometryShader && !f.geometryShader)
     {
-        LOG_ERROR("Required feature 'geometryShader' not supported");
+        LOG_ERROR_CAT(Render, "Required feature 'geometryShader' not supported");
         LOG_REMOVE_TAB();
         THROW_EXCEPTION_FMT("Device '{}' lacks required feature: geometryShader", m_props.deviceName);
     }
 
     if (m_policy.RequiredCoreFeatures.FillModeNonSolid && !f.fillModeNonSolid)
     {
-        LOG_ERROR("Required feature 'fillModeNonSolid' not supported");
+        LOG_ERROR_CAT(Render, "Required feature 'fillModeNonSolid' not supported");
         LOG_REMOVE_TAB();
         THROW_EXCEPTION_FMT("Device '{}' lacks required feature: fillModeNonSolid", m_props.deviceName);
     }
 
-    LOG_SUCCESS("All required core features are supported");
+    LOG_SUCCESS_CAT(Render, "All required core features are supported");
     LOG_REMOVE_TAB();
     return true;
 }
@@ -20,21 +20,19 @@ bool RenderManager::OnInit()
     m_pPhysicalDevice = std::make_unique<FxPhysicalDevice>();
 
     // Vulkan Instance
-    LOG_SCOPE("Vulkan Instance", /*hasNextSibling=*/true);
     {
+        LOG_SCOPE_GUARD("Vulkan Instance", /*hasNextSibling=*/true);
         if (!m_pInstance->Init())
         {
-            LOG_ERROR("Failed to create Vulkan instance");
-            LOG_SCOPE_END();
+            LOG_ERROR_CAT(Render, "Failed to create Vulkan instance");
             return false;
         }
-        LOG_SUCCESS("Instance created");
+        LOG_SUCCESS_CAT(Render, "Instance created");
     }
-    LOG_SCOPE_END();
 
     // Physical Device
-    LOG_SCOPE("Physical Device", /*hasNextSibling=*/false);
     {
+        LOG_SCOPE_GUARD("Physical Device", /*hasNextSibling=*/false);
         FX_PD_SELECTION_POLICY_DESC pol{};
         pol.RequireSwapChain = false;
         m_pPhysicalDevice->Describe(pol);
@@ -42,19 +40,17 @@ bool RenderManager::OnInit()
 
         if (!m_pPhysicalDevice->Init())
         {
-            LOG_ERROR("Failed to initialize physical device");
-            LOG_SCOPE_END();
+            LOG_ERROR_CAT(Render, "Failed to initialize physical device");
             return false;
         }
 
-        LOG_SUCCESS("Selected GPU: {}", m_pPhysicalDevice->Properties().deviceName);
-        LOG_INFO("Queues -> G={}, C={}, T={}, P={}",
-                 m_pPhysicalDevice->Queues().Graphics,
-                 m_pPhysicalDevice->Queues().Compute,
-                 m_pPhysicalDevice->Queues().Transfer,
-                 m_pPhysicalDevice->Queues().Present);
+        LOG_SUCCESS_CAT(Render, "Selected GPU: {}", m_pPhysicalDevice->Properties().deviceName);
+        LOG_INFO_CAT(Render, "Queues -> G={}, C={}, T={}, P={}",
+                              m_pPhysicalDevice->Queues().Graphics,
+                              m_pPhysicalDevice->Queues().Compute,
+                              m_pPhysicalDevice->Queues().Transfer,
+                              m_pPhysicalDevice->Queues().Present);
     }
-    LOG_SCOPE_END();
 
     return true;
 }
@@ -66,7 +62,7 @@ void RenderManager::OnUpdateStart(const float deltaTime)
 
 void RenderManager::OnUpdateEnd()
 {
-
+    if (m_pInstance) m_pInstance->Tick();
 }
 
 void RenderManager::OnRelease()
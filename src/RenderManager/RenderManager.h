@@ -14,6 +14,8 @@ class RenderManager final: public ISystem
 {
     FOX_SYSTEM_GENERATOR(RenderManager);
 public:
+    using Dependencies = SystemList<WindowsManager>;
+
     explicit RenderManager(_fox_In_ WindowsManager* winManager);
     ~RenderManager() override;
 
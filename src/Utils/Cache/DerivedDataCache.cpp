@@ -0,0 +1,380 @@
+#include "DerivedDataCache.h"
+#include "ExceptionHandler/IException.h"
+#include "FileSystem/FileSystem.h"
+#include "Logger/Logger.h"
+
+#define XXH_INLINE_ALL
+#include <xxhash.h>
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <format>
+
+//~ index.fxdc: INDEX_HEADER followed by Capacity INDEX_ENTRY slots, linear probing on Low
+struct DerivedDataCache::INDEX_HEADER
+{
+    char     Magic[4];
+    uint32_t Version;
+    uint32_t Capacity;
+    uint32_t Used;
+    uint32_t Tombstones;
+    uint32_t Clean;       // 0 while a process has it open, a crash leaves it 0 and forces a rebuild
+    uint64_t TotalBytes;
+    uint64_t Clock;       // bumped on every access, orders entries for the LRU
+};
+
+struct DerivedDataCache::INDEX_ENTRY
+{
+    uint64_t Low;
+    uint64_t High;
+    uint64_t Size;
+    uint64_t LastAccess;
+    uint32_t State;
+    uint32_t Reserved;
+};
+
+namespace
+{
+    constexpr char     INDEX_MAGIC[4]{ 'F', 'X', 'D', 'C' };
+    constexpr uint32_t INDEX_VERSION { 1 };
+
+    constexpr uint32_t SLOT_EMPTY    { 0 };
+    constexpr uint32_t SLOT_USED     { 1 };
+    constexpr uint32_t SLOT_TOMBSTONE{ 2 };
+
+    bool ParseHex64(const std::string_view text, uint64_t& value)
+    {
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value, 16);
+        return error == std::errc{} && end == text.data() + text.size();
+    }
+}
+
+std::string DDC_KEY::ToHex() const
+{
+    return std::format("{:016x}{:016x}", High, Low);
+}
+
+DerivedDataCache::DerivedDataCache(const DERIVED_DATA_CACHE_DESC& desc)
+    : m_desc(desc)
+{
+    m_desc.IndexCapacity = std::bit_ceil(std::max<uint32_t>(m_desc.IndexCapacity, 64));
+    FileSystem::CreateDirectories(m_desc.Directory);
+
+    std::scoped_lock lock(m_mutex);
+    if (!OpenIndex())
+    {
+        CloseIndex();
+        LOG_WARNING("[DDC] Index in {} is unavailable, caching without the size cap", m_desc.Directory);
+    }
+}
+
+DerivedDataCache::~DerivedDataCache()
+{
+    std::scoped_lock lock(m_mutex);
+    CloseIndex();
+}
+
+DDC_KEY DerivedDataCache::MakeKey(const std::span<const char> input, const std::string_view buildParameters)
+{
+    const XXH64_hash_t  seed = XXH3_64bits(buildParameters.data(), buildParameters.size());
+    const XXH128_hash_t hash = XXH3_128bits_withSeed(input.data(), input.size(), seed);
+    return { hash.low64, hash.high64 };
+}
+
+std::vector<char> DerivedDataCache::GetOrBuild(const DDC_KEY& key, const Builder& builder)
+{
+    std::vector<char> data;
+    if (Get(key, data)) return data;
+
+    data = builder();
+    Put(key, data);
+    return data;
+}
+
+bool DerivedDataCache::Get(const DDC_KEY& key, std::vector<char>& out)
+{
+    const std::string path = BlobPath(key);
+
+    //~ another thread may evict the blob between the check and the read, both are just a miss
+    bool found = FileSystem::IsFile(path);
+    if (found)
+    {
+        try
+        {
+            out = FileSystem::ReadFromFile(path);
+        }
+        catch (const IException&)
+        {
+            found = false;
+        }
+    }
+
+    std::scoped_lock lock(m_mutex);
+    if (!found)
+    {
+        if (INDEX_ENTRY* entry = Find(key)) Evict(*entry);
+        return false;
+    }
+
+    Record(key, out.size());
+    EnforceSizeCap();
+    return true;
+}
+
+bool DerivedDataCache::Put(const DDC_KEY& key, const std::span<const char> data)
+{
+    const std::string finalPath = BlobPath(key);
+    const std::string tempPath  = std::format("{}\\tmp\\{}.{}.{}.tmp",
+        m_desc.Directory, key.ToHex(), GetCurrentProcessId(), GetCurrentThreadId());
+
+    {
+        FileSystem file{};
+        if (!file.OpenForWrite(tempPath)) return false;
+
+        const bool  written = file.WriteBytes(data.data(), data.size());
+        const DWORD error   = written ? 0 : GetLastError();
+        file.Close();
+
+        // a short write (disk full, quota) must never be published as a valid blob
+        if (!written)
+        {
+            LOG_WARNING("[DDC] Failed to write {} (error {})", tempPath, error);
+            FileSystem::DeleteFiles(tempPath);
+            return false;
+        }
+    }
+
+    if (const auto [DirectoryNames, FileName] = FileSystem::SplitPathFile(finalPath); !DirectoryNames.empty())
+        FileSystem::CreateDirectories(DirectoryNames);
+
+    //~ same volume rename, a reader sees the old blob or the new one, never a partial write
+    if (!MoveFileEx(tempPath.c_str(), finalPath.c_str(), MOVEFILE_REPLACE_EXISTING))
+    {
+        FileSystem::DeleteFiles(tempPath);
+        LOG_WARNING("[DDC] Failed to publish {} (error {})", finalPath, GetLastError());
+        return false;
+    }
+
+    std::scoped_lock lock(m_mutex);
+    Record(key, data.size());
+    EnforceSizeCap();
+    return true;
+}
+
+uint64_t DerivedDataCache::GetTotalBytes() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_pHeader ? m_pHeader->TotalBytes : 0;
+}
+
+bool DerivedDataCache::OpenIndex()
+{
+    const std::string path     = m_desc.Directory + "\\index.fxdc";
+    const uint64_t    viewSize = sizeof(INDEX_HEADER) + uint64_t{ m_desc.IndexCapacity } * sizeof(INDEX_ENTRY);
+
+    //~ exclusive on purpose, a second process sharing the directory still caches, it just skips the bookkeeping
+    m_hIndexFile = CreateFile(
+        path.c_str(),
+        GENERIC_READ | GENERIC_WRITE,
+        0,
+        nullptr,
+        OPEN_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (m_hIndexFile == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER existingSize{};
+    if (!GetFileSizeEx(m_hIndexFile, &existingSize)) return false;
+
+    m_hIndexMapping = CreateFileMapping(
+        m_hIndexFile,
+        nullptr,
+        PAGE_READWRITE,
+        static_cast<DWORD>(viewSize >> 32),
+        static_cast<DWORD>(viewSize & 0xFFFFFFFF),
+        nullptr);
+    if (!m_hIndexMapping) return false;
+
+    m_pIndexView = static_cast<char*>(MapViewOfFile(m_hIndexMapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(viewSize)));
+    if (!m_pIndexView) return false;
+
+    m_pHeader  = reinterpret_cast<INDEX_HEADER*>(m_pIndexView);
+    m_pEntries = reinterpret_cast<INDEX_ENTRY*>(m_pIndexView + sizeof(INDEX_HEADER));
+
+    const bool valid =
+        static_cast<uint64_t>(existingSize.QuadPart) >= viewSize &&
+        std::memcmp(m_pHeader->Magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) == 0 &&
+        m_pHeader->Version  == INDEX_VERSION &&
+        m_pHeader->Capacity == m_desc.IndexCapacity &&
+        m_pHeader->Clean    == 1;
+
+    if (!valid) RebuildIndex();
+    m_pHeader->Clean = 0;
+    return true;
+}
+
+void DerivedDataCache::CloseIndex()
+{
+    if (m_pHeader)
+    {
+        m_pHeader->Clean = 1;
+        FlushViewOfFile(m_pIndexView, 0);
+    }
+    if (m_pIndexView)                         UnmapViewOfFile(m_pIndexView);
+    if (m_hIndexMapping)                      CloseHandle(m_hIndexMapping);
+    if (m_hIndexFile != INVALID_HANDLE_VALUE) CloseHandle(m_hIndexFile);
+
+    m_pIndexView    = nullptr;
+    m_pHeader       = nullptr;
+    m_pEntries      = nullptr;
+    m_hIndexMapping = nullptr;
+    m_hIndexFile    = INVALID_HANDLE_VALUE;
+}
+
+void DerivedDataCache::RebuildIndex()
+{
+    std::memset(m_pIndexView, 0, sizeof(INDEX_HEADER) + size_t{ m_desc.IndexCapacity } * sizeof(INDEX_ENTRY));
+    m_pHeader->Version  = INDEX_VERSION;
+    m_pHeader->Capacity = m_desc.IndexCapacity;
+
+    auto blobs = FileSystem::Scan(m_desc.Directory, [](const std::string_view path, const bool isDirectory)
+    {
+        return isDirectory || path.ends_with(".bin");
+    });
+
+    //~ write time is the best guess at access order for blobs the index lost track of
+    std::ranges::sort(blobs, {}, &FILE_SCAN_ENTRY::LastWriteTime);
+
+    for (const FILE_SCAN_ENTRY& blob : blobs)
+    {
+        const std::string_view path = blob.Path;
+        if (path.size() < 36) continue;
+
+        const std::string_view hex = path.substr(path.size() - 36, 32);
+        DDC_KEY key{};
+        if (!ParseHex64(hex.substr(0, 16), key.High) || !ParseHex64(hex.substr(16), key.Low)) continue;
+        Record(key, blob.Size);
+    }
+    EnforceSizeCap();
+
+    // magic last, a half rebuilt index is never mistaken for a valid one
+    std::memcpy(m_pHeader->Magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+
+    LOG_INFO("[DDC] Rebuilt index for {} ({} blobs, {} bytes)", m_desc.Directory, m_pHeader->Used, m_pHeader->TotalBytes);
+}
+
+std::string DerivedDataCache::BlobPath(const DDC_KEY& key) const
+{
+    const std::string hex = key.ToHex();
+    return std::format("{}\\{}\\{}.bin", m_desc.Directory, hex.substr(0, 2), hex);
+}
+
+DerivedDataCache::INDEX_ENTRY* DerivedDataCache::Find(const DDC_KEY& key) const
+{
+    if (!m_pHeader) return nullptr;
+
+    const uint32_t mask = m_pHeader->Capacity - 1;
+    uint32_t slot = static_cast<uint32_t>(key.Low) & mask;
+    for (uint32_t probe = 0; probe <= mask; ++probe, slot = (slot + 1) & mask)
+    {
+        INDEX_ENTRY& entry = m_pEntries[slot];
+        if (entry.State == SLOT_EMPTY) return nullptr;
+        if (entry.State == SLOT_USED && entry.Low == key.Low && entry.High == key.High) return &entry;
+    }
+    return nullptr;
+}
+
+void DerivedDataCache::Record(const DDC_KEY& key, const uint64_t size)
+{
+    if (!m_pHeader) return;
+
+    if (INDEX_ENTRY* entry = Find(key))
+    {
+        m_pHeader->TotalBytes += size - entry->Size;
+        entry->Size            = size;
+        entry->LastAccess      = ++m_pHeader->Clock;
+        return;
+    }
+
+    //~ tombstones lengthen probes as much as live entries, count both against the load factor
+    if ((uint64_t{ m_pHeader->Used } + m_pHeader->Tombstones + 1) * 4 > uint64_t{ m_pHeader->Capacity } * 3) Compact();
+
+    const uint32_t mask = m_pHeader->Capacity - 1;
+    uint32_t slot = static_cast<uint32_t>(key.Low) & mask;
+    while (m_pEntries[slot].State == SLOT_USED) slot = (slot + 1) & mask;
+
+    INDEX_ENTRY& entry = m_pEntries[slot];
+    if (entry.State == SLOT_TOMBSTONE) --m_pHeader->Tombstones;
+    entry = { key.Low, key.High, size, ++m_pHeader->Clock, SLOT_USED, 0 };
+
+    ++m_pHeader->Used;
+    m_pHeader->TotalBytes += size;
+}
+
+void DerivedDataCache::Evict(INDEX_ENTRY& entry)
+{
+    FileSystem::DeleteFiles(BlobPath({ entry.Low, entry.High }));
+
+    m_pHeader->TotalBytes -= entry.Size;
+    --m_pHeader->Used;
+    ++m_pHeader->Tombstones;
+    entry.State = SLOT_TOMBSTONE;
+}
+
+void DerivedDataCache::Compact()
+{
+    std::vector<INDEX_ENTRY> live;
+    live.reserve(m_pHeader->Used);
+    for (uint32_t i = 0; i < m_pHeader->Capacity; ++i)
+    {
+        if (m_pEntries[i].State == SLOT_USED) live.push_back(m_pEntries[i]);
+    }
+
+    //~ a full table means too many small blobs, drop the oldest until it is half empty again
+    const size_t keep = m_pHeader->Capacity / 2;
+    if (live.size() > keep)
+    {
+        std::ranges::sort(live, std::ranges::greater{}, &INDEX_ENTRY::LastAccess);
+        for (size_t i = keep; i < live.size(); ++i)
+        {
+            FileSystem::DeleteFiles(BlobPath({ live[i].Low, live[i].High }));
+            m_pHeader->TotalBytes -= live[i].Size;
+        }
+        live.resize(keep);
+    }
+
+    std::memset(m_pEntries, 0, size_t{ m_pHeader->Capacity } * sizeof(INDEX_ENTRY));
+    m_pHeader->Used       = static_cast<uint32_t>(live.size());
+    m_pHeader->Tombstones = 0;
+
+    const uint32_t mask = m_pHeader->Capacity - 1;
+    for (const INDEX_ENTRY& entry : live)
+    {
+        uint32_t slot = static_cast<uint32_t>(entry.Low) & mask;
+        while (m_pEntries[slot].State == SLOT_USED) slot = (slot + 1) & mask;
+        m_pEntries[slot] = entry;
+    }
+}
+
+void DerivedDataCache::EnforceSizeCap()
+{
+    if (!m_pHeader || m_pHeader->TotalBytes <= m_desc.MaxBytes) return;
+
+    std::vector<INDEX_ENTRY*> used;
+    used.reserve(m_pHeader->Used);
+    for (uint32_t i = 0; i < m_pHeader->Capacity; ++i)
+    {
+        if (m_pEntries[i].State == SLOT_USED) used.push_back(&m_pEntries[i]);
+    }
+    std::ranges::sort(used, {}, [](const INDEX_ENTRY* entry) { return entry->LastAccess; });
+
+    //~ trim below the cap so the next few puts don't each pay for a pass
+    const uint64_t target = m_desc.MaxBytes / 10 * 9;
+    for (INDEX_ENTRY* entry : used)
+    {
+        if (m_pHeader->TotalBytes <= target) break;
+        Evict(*entry);
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef DERIVEDDATACACHE_H
+#define DERIVEDDATACACHE_H
+
+#include "Common/DefineWindows.h"
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+typedef struct DDC_KEY
+{
+    uint64_t Low { 0 };
+    uint64_t High{ 0 };
+
+    [[nodiscard]] std::string ToHex() const;
+    bool operator==(const DDC_KEY&) const = default;
+} DDC_KEY;
+
+typedef struct DERIVED_DATA_CACHE_DESC
+{
+    std::string Directory     = "DerivedDataCache";
+    uint64_t    MaxBytes      = 2ull * 1024 * 1024 * 1024; // least recently used blobs go past this
+    uint32_t    IndexCapacity = 1u << 16;                   // index slots, rounded up to a power of two
+} DERIVED_DATA_CACHE_DESC;
+
+/**
+ * @brief Content-addressed store for derived artifacts (SPIR-V, decoded textures, cooked meshes).
+ *        Blobs live as <Directory>\xx\<key>.bin and are published by renaming a finished temp file,
+ *        so a reader never sees half a blob. Sizes and access order sit in a memory-mapped index
+ *        that drives the LRU size cap, losing it only costs a rebuild from the directory.
+ */
+class DerivedDataCache
+{
+public:
+    using Builder = std::function<std::vector<char>()>;
+
+    explicit DerivedDataCache(const DERIVED_DATA_CACHE_DESC& desc = {});
+    ~DerivedDataCache();
+
+    DerivedDataCache(const DerivedDataCache&)            = delete;
+    DerivedDataCache& operator=(const DerivedDataCache&) = delete;
+
+    //~ XXH3-128 of the input bytes, seeded with a hash of whatever else shapes the output
+    //~ (compiler flags, target format, pipeline version)
+    static DDC_KEY MakeKey(std::span<const char> input, std::string_view buildParameters);
+
+    //~ Cached bytes when the key is known, otherwise runs builder, publishes and returns its output.
+    //~ Exceptions from builder propagate and nothing is stored
+    std::vector<char> GetOrBuild(const DDC_KEY& key, const Builder& builder);
+
+    bool Get(const DDC_KEY& key, std::vector<char>& out);
+    bool Put(const DDC_KEY& key, std::span<const char> data);
+
+    [[nodiscard]] uint64_t GetTotalBytes() const;
+    [[nodiscard]] bool     HasIndex     () const { return m_pHeader != nullptr; }
+
+private:
+    struct INDEX_HEADER;
+    struct INDEX_ENTRY;
+
+    bool OpenIndex();
+    void CloseIndex();
+    void RebuildIndex();
+
+    [[nodiscard]] std::string BlobPath(const DDC_KEY& key) const;
+
+    //~ All of these expect m_mutex to be held
+    INDEX_ENTRY* Find  (const DDC_KEY& key) const;
+    void         Record(const DDC_KEY& key, uint64_t size);
+    void         Evict (INDEX_ENTRY& entry);
+    void         Compact();
+    void         EnforceSizeCap();
+
+private:
+    DERIVED_DATA_CACHE_DESC m_desc;
+    mutable std::mutex      m_mutex;
+
+    HANDLE        m_hIndexFile   { INVALID_HANDLE_VALUE };
+    HANDLE        m_hIndexMapping{ nullptr };
+    char*         m_pIndexView   { nullptr };
+    INDEX_HEADER* m_pHeader      { nullptr };
+    INDEX_ENTRY*  m_pEntries     { nullptr };
+};
+
+#endif //DERIVEDDATACACHE_H
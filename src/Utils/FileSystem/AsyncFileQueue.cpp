@@ -0,0 +1,263 @@
+#include "AsyncFileQueue.h"
+
+#include <algorithm>
+
+namespace
+{
+    constexpr ULONG_PTR READ_KEY = 1;
+    constexpr ULONG_PTR QUIT_KEY = 2;
+}
+
+AsyncFileQueue::AsyncFileQueue(const ASYNC_FILE_QUEUE_DESC& desc)
+    : m_desc(desc)
+{
+    m_desc.QueueDepth = std::max(m_desc.QueueDepth, 1u);
+
+    if (!m_desc.ForceFallback)
+        m_hPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, m_desc.CompletionThreads);
+
+    if (m_hPort)
+    {
+        for (uint32_t i = 0; i < std::max(m_desc.CompletionThreads, 1u); ++i)
+            m_threads.emplace_back([this] { CompletionLoop(); });
+        return;
+    }
+
+    // no completion port: plain blocking reads spread over a small pool
+    for (uint32_t i = 0; i < std::max(m_desc.FallbackThreads, 1u); ++i)
+        m_threads.emplace_back([this] { BlockingLoop(); });
+}
+
+AsyncFileQueue::~AsyncFileQueue()
+{
+    // reads that never started are failed, the ones in flight are allowed to land
+    std::deque<std::unique_ptr<READ_OP>> abandoned;
+    {
+        std::scoped_lock lock(m_mutex);
+        m_bStopping = true;
+        abandoned.swap(m_pending);
+        m_nInFlight += static_cast<uint32_t>(abandoned.size());
+    }
+    for (auto& op : abandoned) Complete(op.release(), 0, ERROR_OPERATION_ABORTED);
+
+    m_workCv.notify_all();
+    WaitIdle();
+
+    if (m_hPort)
+    {
+        for (size_t i = 0; i < m_threads.size(); ++i)
+            PostQueuedCompletionStatus(m_hPort, 0, QUIT_KEY, nullptr);
+    }
+    m_threads.clear();
+
+    if (m_hPort) CloseHandle(m_hPort);
+}
+
+std::future<FILE_READ_RESULT> AsyncFileQueue::Submit(FILE_READ_REQUEST request)
+{
+    std::vector<FILE_READ_REQUEST> batch;
+    batch.push_back(std::move(request));
+    return std::move(Submit(std::move(batch)).front());
+}
+
+std::vector<std::future<FILE_READ_RESULT>> AsyncFileQueue::Submit(std::vector<FILE_READ_REQUEST> batch)
+{
+    std::vector<std::future<FILE_READ_RESULT>> futures;
+    std::vector<std::unique_ptr<READ_OP>>      ops;
+    futures.reserve(batch.size());
+    ops.reserve(batch.size());
+
+    for (FILE_READ_REQUEST& request : batch)
+    {
+        auto op = std::make_unique<READ_OP>();
+        op->Request = std::move(request);
+        futures.push_back(op->Promise.get_future());
+        ops.push_back(std::move(op));
+    }
+
+    Enqueue(ops);
+    return futures;
+}
+
+void AsyncFileQueue::WaitIdle()
+{
+    std::unique_lock lock(m_mutex);
+    m_idleCv.wait(lock, [this] { return m_pending.empty() && m_nInFlight == 0; });
+}
+
+void AsyncFileQueue::Enqueue(std::vector<std::unique_ptr<READ_OP>>& ops)
+{
+    {
+        std::scoped_lock lock(m_mutex);
+        if (!m_bStopping)
+        {
+            // one lock for the whole batch
+            for (auto& op : ops) m_pending.push_back(std::move(op));
+            ops.clear();
+        }
+        else
+        {
+            m_nInFlight += static_cast<uint32_t>(ops.size());
+        }
+    }
+
+    // only non-empty if the queue is shutting down
+    for (auto& op : ops) Complete(op.release(), 0, ERROR_OPERATION_ABORTED);
+
+    if (m_hPort) IssuePending();
+    else         m_workCv.notify_all();
+}
+
+void AsyncFileQueue::IssuePending()
+{
+    for (;;)
+    {
+        std::unique_ptr<READ_OP> op;
+        {
+            std::scoped_lock lock(m_mutex);
+            if (m_pending.empty() || m_nInFlight >= m_desc.QueueDepth) return;
+
+            op = std::move(m_pending.front());
+            m_pending.pop_front();
+            ++m_nInFlight;
+        }
+        Issue(op.release());
+    }
+}
+
+void AsyncFileQueue::Issue(READ_OP* op)
+{
+    op->File = CreateFile(
+        op->Request.Path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED,
+        nullptr);
+
+    if (op->File == INVALID_HANDLE_VALUE || !CreateIoCompletionPort(op->File, m_hPort, READ_KEY, 0))
+    {
+        Complete(op, 0, GetLastError());
+        return;
+    }
+
+    op->Overlapped.Offset     = static_cast<DWORD>(op->Request.Offset & 0xFFFFFFFF);
+    op->Overlapped.OffsetHigh = static_cast<DWORD>(op->Request.Offset >> 32);
+
+    // synchronous success still queues a packet, only hard failures are handled here
+    if (!ReadFile(op->File, op->Request.Destination, op->Request.Length, nullptr, &op->Overlapped))
+    {
+        if (const DWORD error = GetLastError(); error != ERROR_IO_PENDING)
+            Complete(op, 0, error);
+    }
+}
+
+void AsyncFileQueue::Complete(READ_OP* raw, const DWORD bytes, const DWORD error)
+{
+    std::unique_ptr<READ_OP> op(raw);
+    if (op->File != INVALID_HANDLE_VALUE) CloseHandle(op->File);
+
+    const FILE_READ_RESULT result{ bytes, error };
+    op->Promise.set_value(result);
+
+    if (op->Request.OnComplete)
+    {
+        if (m_desc.Dispatcher)
+        {
+            auto callback = std::move(op->Request.OnComplete);
+            m_desc.Dispatcher([callback = std::move(callback), request = std::move(op->Request), result]
+            {
+                callback(request, result);
+            });
+        }
+        else
+        {
+            op->Request.OnComplete(op->Request, result);
+        }
+    }
+
+    std::scoped_lock lock(m_mutex);
+    --m_nInFlight;
+    m_idleCv.notify_all();
+}
+
+void AsyncFileQueue::CompletionLoop()
+{
+    OVERLAPPED_ENTRY entries[64];
+    for (;;)
+    {
+        ULONG count = 0;
+        if (!GetQueuedCompletionStatusEx(m_hPort, entries, static_cast<ULONG>(std::size(entries)), &count, INFINITE, FALSE))
+            return;
+
+        uint32_t quits = 0;
+        for (ULONG i = 0; i < count; ++i)
+        {
+            if (entries[i].lpCompletionKey == QUIT_KEY)
+            {
+                ++quits;
+                continue;
+            }
+
+            auto* op = CONTAINING_RECORD(entries[i].lpOverlapped, READ_OP, Overlapped);
+
+            // the batch entry has no status, ask the overlapped for it (EOF, device errors)
+            DWORD bytes = 0;
+            DWORD error = 0;
+            if (!GetOverlappedResult(op->File, &op->Overlapped, &bytes, FALSE)) error = GetLastError();
+            Complete(op, bytes, error);
+        }
+
+        if (quits)
+        {
+            // one quit per thread, hand back the ones this batch grabbed for the others
+            for (uint32_t i = 1; i < quits; ++i) PostQueuedCompletionStatus(m_hPort, 0, QUIT_KEY, nullptr);
+            return;
+        }
+        IssuePending();
+    }
+}
+
+void AsyncFileQueue::BlockingLoop()
+{
+    for (;;)
+    {
+        std::unique_ptr<READ_OP> op;
+        {
+            std::unique_lock lock(m_mutex);
+            m_workCv.wait(lock, [this] { return m_bStopping || !m_pending.empty(); });
+            if (m_pending.empty()) return;
+
+            op = std::move(m_pending.front());
+            m_pending.pop_front();
+            ++m_nInFlight;
+        }
+
+        DWORD bytes = 0;
+        DWORD error = 0;
+        op->File = CreateFile(
+            op->Request.Path.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL,
+            nullptr);
+
+        if (op->File == INVALID_HANDLE_VALUE)
+        {
+            error = GetLastError();
+        }
+        else
+        {
+            // positional read, same as pread
+            op->Overlapped.Offset     = static_cast<DWORD>(op->Request.Offset & 0xFFFFFFFF);
+            op->Overlapped.OffsetHigh = static_cast<DWORD>(op->Request.Offset >> 32);
+            if (!ReadFile(op->File, op->Request.Destination, op->Request.Length, &bytes, &op->Overlapped))
+                error = GetLastError();
+        }
+
+        Complete(op.release(), bytes, error);
+    }
+}
@@ -0,0 +1,96 @@
+#ifndef ASYNCFILEQUEUE_H
+#define ASYNCFILEQUEUE_H
+
+#include "Common/DefineWindows.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef struct FILE_READ_RESULT
+{
+    uint32_t BytesRead{ 0 };
+    uint32_t Error    { 0 }; // Win32 error code, 0 on success
+
+    [[nodiscard]] bool Succeeded() const { return Error == 0; }
+} FILE_READ_RESULT;
+
+typedef struct FILE_READ_REQUEST
+{
+    std::string Path;
+    uint64_t    Offset{ 0 };
+    uint32_t    Length{ 0 };          // bytes to read, Destination must hold at least this much
+    void*       Destination{ nullptr };
+
+    //~ Optional, runs through ASYNC_FILE_QUEUE_DESC::Dispatcher when set
+    std::function<void(const FILE_READ_REQUEST&, const FILE_READ_RESULT&)> OnComplete;
+} FILE_READ_REQUEST;
+
+typedef struct ASYNC_FILE_QUEUE_DESC
+{
+    uint32_t QueueDepth        = 64; // reads in flight at once
+    uint32_t CompletionThreads = 1;  // threads draining the completion port
+    uint32_t FallbackThreads   = 8;  // blocking readers when the completion port is unavailable
+    bool     ForceFallback     = false;
+
+    //~ Where OnComplete callbacks run (engine workers), null runs them on the I/O thread
+    std::function<void(std::function<void()>)> Dispatcher;
+} ASYNC_FILE_QUEUE_DESC;
+
+/**
+ * @brief Batched overlapped reads on an I/O completion port, with a blocking thread-pool fallback.
+ *        Destination buffers must stay alive until the request completes.
+ */
+class AsyncFileQueue
+{
+public:
+    explicit AsyncFileQueue(const ASYNC_FILE_QUEUE_DESC& desc = {});
+    ~AsyncFileQueue();
+
+    AsyncFileQueue(const AsyncFileQueue&)            = delete;
+    AsyncFileQueue& operator=(const AsyncFileQueue&) = delete;
+
+    std::future<FILE_READ_RESULT>              Submit(FILE_READ_REQUEST request);
+    std::vector<std::future<FILE_READ_RESULT>> Submit(std::vector<FILE_READ_REQUEST> batch);
+
+    //~ Blocks until every submitted read has completed
+    void WaitIdle();
+
+    [[nodiscard]] bool IsUsingCompletionPort() const { return m_hPort != nullptr; }
+
+private:
+    struct READ_OP
+    {
+        OVERLAPPED                     Overlapped{};
+        FILE_READ_REQUEST              Request;
+        HANDLE                         File{ INVALID_HANDLE_VALUE };
+        std::promise<FILE_READ_RESULT> Promise;
+    };
+
+    void Enqueue(std::vector<std::unique_ptr<READ_OP>>& ops);
+    void IssuePending();
+    void Issue(READ_OP* op);
+    void Complete(READ_OP* op, DWORD bytes, DWORD error);
+
+    void CompletionLoop();
+    void BlockingLoop();
+
+private:
+    ASYNC_FILE_QUEUE_DESC                m_desc;
+    HANDLE                               m_hPort{ nullptr };
+    std::mutex                           m_mutex;
+    std::condition_variable              m_workCv;
+    std::condition_variable              m_idleCv;
+    std::deque<std::unique_ptr<READ_OP>> m_pending;
+    uint32_t                             m_nInFlight{ 0 };
+    bool                                 m_bStopping{ false };
+    std::vector<std::jthread>            m_threads;
+};
+
+#endif //ASYNCFILEQUEUE_H
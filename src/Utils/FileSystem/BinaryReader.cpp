@@ -0,0 +1,139 @@
+#include "BinaryReader.h"
+
+#include <algorithm>
+
+BinaryReader::BinaryReader(const size_t bufferSize)
+    : m_buffer(std::max<size_t>(bufferSize, 64 * 1024))
+{}
+
+bool BinaryReader::Open(const std::string& path)
+{
+    Close();
+    if (!m_file.OpenForRead(path)) return false;
+
+    m_nFileSize      = m_file.GetFileSize();
+    m_nFileRemaining = m_nFileSize;
+    return true;
+}
+
+void BinaryReader::Close()
+{
+    m_file.Close();
+    m_nBegin         = 0;
+    m_nEnd           = 0;
+    m_nFileSize      = 0;
+    m_nFileRemaining = 0;
+}
+
+bool BinaryReader::ReadBytes(void* dest, size_t size)
+{
+    const size_t buffered = m_nEnd - m_nBegin;
+    if (size > Remaining()) return false;
+
+    auto out = static_cast<char*>(dest);
+
+    const size_t fromBuffer = std::min(size, buffered);
+    std::memcpy(out, m_buffer.data() + m_nBegin, fromBuffer);
+    m_nBegin += fromBuffer;
+    out      += fromBuffer;
+    size     -= fromBuffer;
+    if (size == 0) return true;
+
+    // big arrays skip the buffer and land in dest directly
+    if (size >= m_buffer.size())
+    {
+        if (!m_file.ReadBytes(out, size)) return Fail();
+        m_nFileRemaining -= size;
+        return true;
+    }
+
+    if (!Ensure(size)) return false;
+    std::memcpy(out, m_buffer.data() + m_nBegin, size);
+    m_nBegin += size;
+    return true;
+}
+
+bool BinaryReader::ReadVarint(uint64_t& value)
+{
+    // a varint is at most 10 bytes, near the end of the file there may be fewer
+    if (m_nEnd - m_nBegin < 10) Ensure(static_cast<size_t>(std::min<uint64_t>(10, Remaining())));
+
+    uint64_t result = 0;
+    size_t   cursor = m_nBegin;
+    for (int shift = 0; shift < 64 && cursor < m_nEnd; shift += 7)
+    {
+        const auto b = static_cast<uint8_t>(m_buffer[cursor++]);
+        result |= static_cast<uint64_t>(b & 0x7F) << shift;
+        if (!(b & 0x80))
+        {
+            m_nBegin = cursor;
+            value    = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BinaryReader::ReadVarintSigned(int64_t& value)
+{
+    uint64_t raw = 0;
+    if (!ReadVarint(raw)) return false;
+    value = static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+    return true;
+}
+
+bool BinaryReader::ReadString(std::string& text)
+{
+    std::string_view view;
+    if (!ReadStringView(view)) return false;
+    text.assign(view);
+    return true;
+}
+
+bool BinaryReader::ReadStringView(std::string_view& text)
+{
+    const uint64_t start = Tell();
+    uint64_t length = 0;
+    if (!ReadVarint(length)) return false;
+    if (length > Remaining())
+    {
+        Unread(start);
+        return false;
+    }
+
+    if (!Ensure(static_cast<size_t>(length))) return false;
+    text = { m_buffer.data() + m_nBegin, static_cast<size_t>(length) };
+    m_nBegin += static_cast<size_t>(length);
+    return true;
+}
+
+bool BinaryReader::Ensure(const size_t minBytes)
+{
+    size_t buffered = m_nEnd - m_nBegin;
+    if (buffered >= minBytes) return true;
+    if (minBytes > Remaining()) return false;
+
+    // slide the leftovers to the front, grow only for strings longer than the window
+    if (m_nBegin > 0)
+    {
+        std::memmove(m_buffer.data(), m_buffer.data() + m_nBegin, buffered);
+        m_nBegin = 0;
+        m_nEnd   = buffered;
+    }
+    if (minBytes > m_buffer.size()) m_buffer.resize(minBytes);
+
+    const size_t toRead = static_cast<size_t>(std::min<uint64_t>(m_buffer.size() - m_nEnd, m_nFileRemaining));
+    if (!m_file.ReadBytes(m_buffer.data() + m_nEnd, toRead)) return Fail();
+
+    m_nEnd           += toRead;
+    m_nFileRemaining -= toRead;
+    return m_nEnd - m_nBegin >= minBytes;
+}
+
+bool BinaryReader::Fail()
+{
+    m_nBegin         = 0;
+    m_nEnd           = 0;
+    m_nFileRemaining = 0;
+    return false;
+}
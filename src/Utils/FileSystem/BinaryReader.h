@@ -0,0 +1,103 @@
+#ifndef BINARYREADER_H
+#define BINARYREADER_H
+
+#include "FileSystem.h"
+
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Buffered counterpart of BinaryWriter, refills a 64 KB+ window instead of one ReadFile per value.
+ *        Every Read* checks the remaining size before consuming anything, so running out of file returns
+ *        false with the destination and Tell() untouched. A ReadFile error past that check is not
+ *        recoverable: the reader drops to EOF and the destination may hold a partial value.
+ */
+class BinaryReader
+{
+public:
+    explicit BinaryReader(size_t bufferSize = 64 * 1024);
+    ~BinaryReader() = default;
+
+    BinaryReader(const BinaryReader&)            = delete;
+    BinaryReader& operator=(const BinaryReader&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    [[nodiscard]] bool     IsOpen() const { return m_file.IsOpen(); }
+    [[nodiscard]] bool     IsEof () const { return m_nBegin == m_nEnd && m_nFileRemaining == 0; }
+    [[nodiscard]] uint64_t Tell  () const { return m_nFileSize - m_nFileRemaining - (m_nEnd - m_nBegin); }
+
+    bool ReadBytes(void* dest, size_t size);
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    bool Read(T& value);
+
+    //~ Raw bulk copy into values, no count prefix
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    bool ReadArray(std::span<T> values) { return ReadBytes(values.data(), values.size_bytes()); }
+
+    //~ Varint count followed by the raw elements (BinaryWriter::WriteVector)
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    bool ReadVector(std::vector<T>& values);
+
+    bool ReadVarint      (uint64_t& value);
+    bool ReadVarintSigned(int64_t& value);
+    bool ReadString      (std::string& text);
+
+    //~ Points into the internal buffer, valid until the next Read* call
+    bool ReadStringView(std::string_view& text);
+
+private:
+    //~ Makes at least minBytes contiguous in the buffer, false if the file is shorter
+    bool Ensure(size_t minBytes);
+
+    //~ Drops everything after a ReadFile error so later reads fail instead of returning garbage
+    bool Fail();
+
+    //~ Steps back to start, only valid while nothing was refilled since (the prefix is still buffered)
+    void Unread(uint64_t start) { m_nBegin -= static_cast<size_t>(Tell() - start); }
+
+    [[nodiscard]] uint64_t Remaining() const { return (m_nEnd - m_nBegin) + m_nFileRemaining; }
+
+private:
+    FileSystem        m_file{};
+    std::vector<char> m_buffer;
+    size_t            m_nBegin        { 0 };
+    size_t            m_nEnd          { 0 };
+    uint64_t          m_nFileSize     { 0 };
+    uint64_t          m_nFileRemaining{ 0 };
+};
+
+template<typename T> requires std::is_trivially_copyable_v<T>
+inline bool BinaryReader::Read(T& value)
+{
+    if (m_nEnd - m_nBegin < sizeof(T) && !Ensure(sizeof(T))) return false;
+    std::memcpy(&value, m_buffer.data() + m_nBegin, sizeof(T));
+    m_nBegin += sizeof(T);
+    return true;
+}
+
+template<typename T> requires std::is_trivially_copyable_v<T>
+inline bool BinaryReader::ReadVector(std::vector<T>& values)
+{
+    const uint64_t start = Tell();
+    uint64_t count = 0;
+    if (!ReadVarint(count)) return false;
+
+    // a corrupt count must not turn into a huge allocation, divide so count * sizeof(T) can't wrap
+    if (count > Remaining() / sizeof(T))
+    {
+        Unread(start);
+        return false;
+    }
+
+    values.resize(static_cast<size_t>(count));
+    return ReadArray(std::span<T>(values));
+}
+
+#endif //BINARYREADER_H
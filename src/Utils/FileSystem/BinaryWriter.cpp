@@ -0,0 +1,113 @@
+#include "BinaryWriter.h"
+
+#include <algorithm>
+
+BinaryWriter::BinaryWriter(const size_t bufferSize)
+    : m_buffer(std::max<size_t>(bufferSize, 64 * 1024))
+{}
+
+BinaryWriter::~BinaryWriter()
+{
+    Close();
+}
+
+bool BinaryWriter::Open(const std::string& path)
+{
+    Close();
+    m_nUsed    = 0;
+    m_nFlushed = 0;
+    m_bFailed  = !m_file.OpenForWrite(path);
+    return !m_bFailed;
+}
+
+bool BinaryWriter::Close()
+{
+    FlushBuffer();
+    m_file.Close();
+    return !m_bFailed;
+}
+
+bool BinaryWriter::Flush()
+{
+    FlushBuffer();
+    if (!m_bFailed) m_file.Flush();
+    return !m_bFailed;
+}
+
+void BinaryWriter::WriteBytes(const void* data, size_t size)
+{
+    if (m_bFailed) return;
+
+    auto src = static_cast<const char*>(data);
+
+    // small writes are coalesced, anything that would not fit goes straight to the file
+    if (size <= m_buffer.size() - m_nUsed)
+    {
+        std::memcpy(m_buffer.data() + m_nUsed, src, size);
+        m_nUsed += size;
+        return;
+    }
+
+    FlushBuffer();
+    if (m_bFailed) return;
+    if (size < m_buffer.size())
+    {
+        std::memcpy(m_buffer.data(), src, size);
+        m_nUsed = size;
+        return;
+    }
+
+    if (!m_file.WriteBytes(src, size))
+    {
+        m_bFailed = true;
+        return;
+    }
+    m_nFlushed += size;
+}
+
+void BinaryWriter::WriteVarint(uint64_t value)
+{
+    if (m_bFailed) return;
+    if (m_buffer.size() - m_nUsed < 10)
+    {
+        FlushBuffer();
+        if (m_bFailed) return;
+    }
+
+    char* out = m_buffer.data() + m_nUsed;
+    size_t n  = 0;
+    do
+    {
+        auto b = static_cast<uint8_t>(value & 0x7F);
+        value >>= 7;
+        if (value) b |= 0x80;
+        out[n++] = static_cast<char>(b);
+    } while (value);
+    m_nUsed += n;
+}
+
+void BinaryWriter::WriteVarintSigned(const int64_t value)
+{
+    WriteVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+void BinaryWriter::WriteString(const std::string_view text)
+{
+    WriteVarint(text.size());
+    WriteBytes(text.data(), text.size());
+}
+
+void BinaryWriter::FlushBuffer()
+{
+    if (m_nUsed == 0) return;
+
+    // a short write or a writer that never opened, whatever is buffered is lost and Tell stays put
+    if (m_bFailed || !m_file.WriteBytes(m_buffer.data(), m_nUsed))
+    {
+        m_bFailed = true;
+        m_nUsed   = 0;
+        return;
+    }
+    m_nFlushed += m_nUsed;
+    m_nUsed     = 0;
+}
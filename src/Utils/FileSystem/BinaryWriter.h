@@ -0,0 +1,87 @@
+#ifndef BINARYWRITER_H
+#define BINARYWRITER_H
+
+#include "FileSystem.h"
+
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Buffered serializer over FileSystem, one WriteFile per buffer instead of per value.
+ *        Strings and counts are varint length prefixed, flushes on destruction.
+ *        The first failed or short write is sticky: later writes are dropped, Tell stops advancing
+ *        and Flush/Close report false until the next Open.
+ */
+class BinaryWriter
+{
+public:
+    explicit BinaryWriter(size_t bufferSize = 64 * 1024);
+    ~BinaryWriter();
+
+    BinaryWriter(const BinaryWriter&)            = delete;
+    BinaryWriter& operator=(const BinaryWriter&) = delete;
+
+    bool Open(const std::string& path);
+    bool Close();
+    bool Flush();
+
+    [[nodiscard]] bool     IsOpen   () const { return m_file.IsOpen(); }
+    [[nodiscard]] bool     HasFailed() const { return m_bFailed; }
+    [[nodiscard]] uint64_t Tell     () const { return m_nFlushed + m_nUsed; }
+
+    void WriteBytes(const void* data, size_t size);
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void Write(const T& value);
+
+    //~ Raw bulk copy, no count prefix
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void WriteArray(std::span<const T> values) { WriteBytes(values.data(), values.size_bytes()); }
+
+    //~ Varint count followed by the raw elements
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void WriteVector(const std::vector<T>& values);
+
+    void WriteVarint      (uint64_t value);
+    void WriteVarintSigned(int64_t value);   // zigzag
+    void WriteString      (std::string_view text);
+
+private:
+    void FlushBuffer();
+
+private:
+    FileSystem        m_file{};
+    std::vector<char> m_buffer;
+    size_t            m_nUsed   { 0 };
+    uint64_t          m_nFlushed{ 0 };
+    bool              m_bFailed { false };
+};
+
+template<typename T> requires std::is_trivially_copyable_v<T>
+inline void BinaryWriter::Write(const T& value)
+{
+    if (m_bFailed) return;
+
+    // fixed-size fast path, the compiler turns this into a single store
+    if (m_buffer.size() - m_nUsed < sizeof(T))
+    {
+        // WriteBytes flushes, and also copes with a T larger than the whole buffer
+        WriteBytes(&value, sizeof(T));
+        return;
+    }
+    std::memcpy(m_buffer.data() + m_nUsed, &value, sizeof(T));
+    m_nUsed += sizeof(T);
+}
+
+template<typename T> requires std::is_trivially_copyable_v<T>
+inline void BinaryWriter::WriteVector(const std::vector<T>& values)
+{
+    WriteVarint(values.size());
+    WriteArray(std::span<const T>(values));
+}
+
+#endif //BINARYWRITER_H
@@ -5,6 +5,59 @@
 #include "FileSystem.h"
 #include "ExceptionHandler/IException.h"
 #include <ostream>
+#include <algorithm>
+#include <condition_variable>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	//~ One FindFirstFileEx pass, LARGE_FETCH pulls entries in big batches instead of one call per file
+	void ScanDirectory(
+		const std::string& directory,
+		const FileScanFilter& filter,
+		std::vector<FILE_SCAN_ENTRY>& files,
+		std::vector<std::string>& subDirectories)
+	{
+		WIN32_FIND_DATA data{};
+		const std::string pattern = directory + "\\*";
+		HANDLE find = FindFirstFileEx(
+			pattern.c_str(),
+			FindExInfoBasic,
+			&data,
+			FindExSearchNameMatch,
+			nullptr,
+			FIND_FIRST_EX_LARGE_FETCH
+		);
+
+		if (find == INVALID_HANDLE_VALUE) return;
+
+		do
+		{
+			const char* name = data.cFileName;
+			if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) continue;
+
+			std::string path = directory + '\\' + name;
+			if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			{
+				//~ junctions and symlinks can loop back into the tree
+				if (data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) continue;
+				if (!filter || filter(path, true)) subDirectories.push_back(std::move(path));
+				continue;
+			}
+
+			if (filter && !filter(path, false)) continue;
+			files.push_back({
+				std::move(path),
+				(static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow,
+				(static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime
+			});
+		} while (FindNextFile(find, &data));
+
+		FindClose(find);
+	}
+}
 
 bool FileSystem::OpenForRead(const std::string& path)
 {
@@ -54,20 +107,39 @@ void FileSystem::Close()
 	}
 }
 
-bool FileSystem::ReadBytes(void* dest, const size_t size) const
+bool FileSystem::ReadBytes(void* dest, size_t size) const
 {
 	if (!m_bReadMode || m_hFile == INVALID_HANDLE_VALUE) return false;
 
-	DWORD bytesRead = 0;
-	return ReadFile(m_hFile, dest, static_cast<DWORD>(size), &bytesRead, nullptr) && bytesRead == size;
+	//~ ReadFile takes a DWORD, anything over 4 GB needs several calls
+	auto out = static_cast<char*>(dest);
+	while (size > 0)
+	{
+		const DWORD chunk = static_cast<DWORD>(std::min<size_t>(size, MAX_IO_CHUNK));
+		DWORD bytesRead = 0;
+		if (!ReadFile(m_hFile, out, chunk, &bytesRead, nullptr) || bytesRead != chunk) return false;
+
+		out  += chunk;
+		size -= chunk;
+	}
+	return true;
 }
 
-void FileSystem::WriteBytes(const void* data, size_t size) const
+bool FileSystem::WriteBytes(const void* data, size_t size) const
 {
-	if (m_bReadMode || m_hFile == INVALID_HANDLE_VALUE) return;
+	if (m_bReadMode || m_hFile == INVALID_HANDLE_VALUE) return false;
+
+	auto src = static_cast<const char*>(data);
+	while (size > 0)
+	{
+		const DWORD chunk = static_cast<DWORD>(std::min<size_t>(size, MAX_IO_CHUNK));
+		DWORD bytesWritten = 0;
+		if (!WriteFile(m_hFile, src, chunk, &bytesWritten, nullptr) || bytesWritten != chunk) return false;
 
-	DWORD bytesWritten = 0;
-	WriteFile(m_hFile, data, static_cast<DWORD>(size), &bytesWritten, nullptr) && bytesWritten == size;
+		src  += chunk;
+		size -= chunk;
+	}
+	return true;
 }
 
 bool FileSystem::ReadUInt32(uint32_t& value) const
@@ -100,13 +172,19 @@ void FileSystem::WriteString(const std::string& str) const
 	WriteBytes(str.data(), len);
 }
 
-void FileSystem::WritePlainText(const std::string& str) const
+void FileSystem::WritePlainText(const std::string_view str) const
 {
 	if (m_bReadMode || m_hFile == INVALID_HANDLE_VALUE) return;
 
-	DWORD bytesWritten = 0;
-	const std::string line = str + "\n";
-	WriteFile(m_hFile, line.c_str(), static_cast<DWORD>(line.size()), &bytesWritten, nullptr);
+	// write in place instead of copying just to append the newline
+	WriteBytes(str.data(), str.size());
+	if (!str.ends_with('\n')) WriteBytes("\n", 1);
+}
+
+void FileSystem::Flush() const
+{
+	if (m_bReadMode || m_hFile == INVALID_HANDLE_VALUE) return;
+	FlushFileBuffers(m_hFile);
 }
 
 uint64_t FileSystem::GetFileSize() const
@@ -131,6 +209,68 @@ bool FileSystem::IsPathExists(const std::wstring& path)
 	return (attr != INVALID_FILE_ATTRIBUTES);
 }
 
+std::vector<FILE_SCAN_ENTRY> FileSystem::Scan(const std::string& root, const FileScanFilter& filter, uint32_t threadCount)
+{
+	if (!IsDirectory(root)) return {};
+	if (threadCount == 0) threadCount = std::clamp(std::thread::hardware_concurrency(), 1u, 8u);
+
+	std::string base = root;
+	while (base.size() > 1 && (base.back() == '\\' || base.back() == '/')) base.pop_back();
+
+	//~ Shared stack of directories still to list, a worker only quits once it is empty and nobody can refill it
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::vector<std::string> pending{ std::move(base) };
+	uint32_t busy = 0;
+
+	std::vector<std::vector<FILE_SCAN_ENTRY>> results(threadCount);
+	auto worker = [&](std::vector<FILE_SCAN_ENTRY>& out)
+		{
+			std::vector<std::string> found;
+			for (;;)
+			{
+				std::string directory;
+				{
+					std::unique_lock lock(mutex);
+					cv.wait(lock, [&] { return !pending.empty() || busy == 0; });
+					if (pending.empty()) return;
+
+					directory = std::move(pending.back());
+					pending.pop_back();
+					++busy;
+				}
+
+				found.clear();
+				ScanDirectory(directory, filter, out, found);
+
+				{
+					std::scoped_lock lock(mutex);
+					--busy;
+					for (std::string& sub : found) pending.push_back(std::move(sub));
+				}
+				cv.notify_all();
+			}
+		};
+
+	{
+		std::vector<std::jthread> helpers;
+		helpers.reserve(threadCount - 1);
+		for (uint32_t i = 1; i < threadCount; ++i) helpers.emplace_back(worker, std::ref(results[i]));
+		worker(results[0]);
+	}
+
+	size_t total = 0;
+	for (const auto& part : results) total += part.size();
+
+	std::vector<FILE_SCAN_ENTRY> entries = std::move(results[0]);
+	entries.reserve(total);
+	for (size_t i = 1; i < results.size(); ++i)
+	{
+		std::move(results[i].begin(), results[i].end(), std::back_inserter(entries));
+	}
+	return entries;
+}
+
 DIRECTORY_AND_FILE_NAME FileSystem::SplitPathFile(const std::string& fullPath)
 {
 	// Supports both '/' and '\\'
@@ -187,6 +327,21 @@ bool FileSystem::MoveFiles(const std::string& source, const std::string& destina
 }
 
 std::vector<char> FileSystem::ReadFromFile(const std::string &fileName)
+{
+	FileSystem file;
+	if (!file.OpenForRead(fileName)) THROW_EXCEPTION_FMT("Failed to open file: {}", fileName);
+
+	const uint64_t fileSize = file.GetFileSize();
+	if (fileSize > SIZE_MAX) THROW_EXCEPTION_MSG("File too large to read into memory.");
+
+	std::vector<char> buffer(static_cast<size_t>(fileSize));
+	if (!file.ReadBytes(buffer.data(), buffer.size())) THROW_EXCEPTION_FMT("Failed to read file: {}", fileName);
+
+	file.Close();
+	return buffer;
+}
+
+MappedFile FileSystem::MapFile(const std::string& fileName, const FileAccessHint hint)
 {
 	HANDLE file = CreateFile(
 			fileName.c_str(),
@@ -207,27 +362,29 @@ std::vector<char> FileSystem::ReadFromFile(const std::string &fileName)
 		THROW_EXCEPTION_FMT("Failed to get file size: {}", fileName);
 	}
 
-	if (fileSize.QuadPart > SIZE_MAX)
+	//~ Windows refuses to map empty files, an empty view is the honest answer
+	if (fileSize.QuadPart == 0)
 	{
 		CloseHandle(file);
-		THROW_EXCEPTION_MSG("File too large to read into memory.");
+		return {};
 	}
 
-	std::vector<char> buffer(static_cast<size_t>(fileSize.QuadPart));
-
-	DWORD bytesRead = 0;
-	if (!ReadFile(file, buffer.data(), static_cast<DWORD>(buffer.size()), &bytesRead, nullptr))
+	HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping)
 	{
 		CloseHandle(file);
-		THROW_EXCEPTION_FMT("Failed to read file: {}", fileName);
+		THROW_EXCEPTION_FMT("Failed to create file mapping: {}", fileName);
 	}
 
-	if (bytesRead != buffer.size())
-	{
-		CloseHandle(file);
-		THROW_EXCEPTION_MSG("Read size mismatch.");
-	}
+	const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
 
+	//~ the view keeps both objects alive on its own
+	CloseHandle(mapping);
 	CloseHandle(file);
-	return buffer;
+
+	if (!view) THROW_EXCEPTION_FMT("Failed to map view of file: {}", fileName);
+
+	MappedFile mapped{ static_cast<const std::byte*>(view), static_cast<size_t>(fileSize.QuadPart) };
+	mapped.ApplyHint(hint);
+	return mapped;
 }
@@ -6,7 +6,10 @@
 #define FILESYSTEM_H
 
 #include "Common/DefineWindows.h"
+#include "MappedFile.h"
+#include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 typedef struct FILE_PATH_INFO
@@ -15,9 +18,22 @@ typedef struct FILE_PATH_INFO
 	std::string FileName;
 } DIRECTORY_AND_FILE_NAME;
 
+typedef struct FILE_SCAN_ENTRY
+{
+	std::string Path;          // root joined with the relative path, backslash separated
+	uint64_t    Size;
+	uint64_t    LastWriteTime; // FILETIME, 100 ns ticks since 1601 UTC
+} FILE_SCAN_ENTRY;
+
+//~ Called from scan workers, return false to skip a file or to prune a whole directory
+using FileScanFilter = std::function<bool(std::string_view path, bool isDirectory)>;
+
 class FileSystem
 {
 public:
+	//~ Largest single ReadFile/WriteFile, ReadBytes and WriteBytes split bigger requests
+	static constexpr size_t MAX_IO_CHUNK = size_t{ 1 } << 30;
+
 	FileSystem() = default;
 	~FileSystem() = default;
 
@@ -31,14 +47,15 @@ public:
 	void Close();
 
 	bool ReadBytes(void* dest, size_t size) const;
-	void WriteBytes(const void* data, size_t size) const;
+	bool WriteBytes(const void* data, size_t size) const;
 
 	bool ReadUInt32(uint32_t& value) const;
 	void WriteUInt32(uint32_t value) const;
 
 	bool ReadString(std::string& outStr) const;
 	void WriteString(const std::string& str) const;
-	void WritePlainText(const std::string& str) const;
+	void WritePlainText(std::string_view str) const;
+	void Flush() const;
 
 	[[nodiscard]] uint64_t GetFileSize() const;
 	[[nodiscard]] bool IsOpen() const;
@@ -53,6 +70,13 @@ public:
 	static bool MoveFiles(const std::string& source, const std::string& destination);
 	static std::vector<char> ReadFromFile(const std::string& fileName);
 
+	//~ Zero-copy alternative to ReadFromFile, the view stays valid until the MappedFile dies
+	static MappedFile MapFile(const std::string& fileName, FileAccessHint hint = FileAccessHint::None);
+
+	//~ Recursive listing of regular files, directories are walked in parallel, order is unspecified.
+	//~ Symlinked and junctioned directories are not followed. threadCount 0 picks one per core (max 8)
+	static std::vector<FILE_SCAN_ENTRY> Scan(const std::string& root, const FileScanFilter& filter = {}, uint32_t threadCount = 0);
+
 	static DIRECTORY_AND_FILE_NAME SplitPathFile(const std::string& fullPath);
 
 	template<typename... Args>
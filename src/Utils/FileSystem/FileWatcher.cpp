@@ -0,0 +1,200 @@
+#include "FileWatcher.h"
+
+#include <algorithm>
+
+FileWatcher::~FileWatcher()
+{
+    Stop();
+}
+
+bool FileWatcher::Start(const FILE_WATCHER_DESC& desc)
+{
+    if (IsRunning()) return false;
+
+    m_desc = desc;
+    while (!m_desc.Directory.empty() && (m_desc.Directory.back() == '\\' || m_desc.Directory.back() == '/'))
+        m_desc.Directory.pop_back();
+    m_desc.BufferSize = std::max<uint32_t>(m_desc.BufferSize, 4096);
+
+    m_hDirectory = CreateFile(
+        m_desc.Directory.c_str(),
+        FILE_LIST_DIRECTORY,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+        nullptr
+    );
+    if (m_hDirectory == INVALID_HANDLE_VALUE) return false;
+
+    m_hStopEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    if (!m_hStopEvent)
+    {
+        CloseHandle(m_hDirectory);
+        m_hDirectory = INVALID_HANDLE_VALUE;
+        return false;
+    }
+
+    m_watchThread = std::jthread([this] { WatchLoop(); });
+    return true;
+}
+
+void FileWatcher::Stop()
+{
+    if (!IsRunning()) return;
+
+    SetEvent(m_hStopEvent);
+    m_watchThread.join();
+
+    CloseHandle(m_hStopEvent);
+    CloseHandle(m_hDirectory);
+    m_hStopEvent = nullptr;
+    m_hDirectory = INVALID_HANDLE_VALUE;
+
+    std::scoped_lock lock(m_mutex);
+    m_pending.clear();
+    m_bOverflow = false;
+}
+
+std::vector<FILE_CHANGE_EVENT> FileWatcher::Poll()
+{
+    std::vector<FILE_CHANGE_EVENT> events;
+    const auto now   = Clock::now();
+    const auto quiet = std::chrono::milliseconds(m_desc.QuietPeriodMs);
+
+    std::scoped_lock lock(m_mutex);
+
+    //~ a rescan covers everything still pending
+    if (m_bOverflow)
+    {
+        m_bOverflow = false;
+        m_pending.clear();
+        events.push_back({ m_desc.Directory, FileChangeAction::Overflow });
+        return events;
+    }
+
+    for (auto it = m_pending.begin(); it != m_pending.end();)
+    {
+        if (now - it->second.LastSeen < quiet)
+        {
+            ++it;
+            continue;
+        }
+        events.push_back({ it->first, it->second.Action });
+        it = m_pending.erase(it);
+    }
+    return events;
+}
+
+void FileWatcher::WatchLoop()
+{
+    constexpr DWORD notifyFilter =
+        FILE_NOTIFY_CHANGE_FILE_NAME  |
+        FILE_NOTIFY_CHANGE_DIR_NAME   |
+        FILE_NOTIFY_CHANGE_SIZE       |
+        FILE_NOTIFY_CHANGE_LAST_WRITE |
+        FILE_NOTIFY_CHANGE_CREATION;
+
+    //~ ReadDirectoryChangesW wants a DWORD aligned buffer
+    std::vector<DWORD> buffer(m_desc.BufferSize / sizeof(DWORD));
+
+    OVERLAPPED overlapped{};
+    overlapped.hEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    if (!overlapped.hEvent) return;
+
+    const HANDLE handles[2]{ overlapped.hEvent, m_hStopEvent };
+    for (;;)
+    {
+        if (!ReadDirectoryChangesW(
+                m_hDirectory,
+                buffer.data(),
+                static_cast<DWORD>(buffer.size() * sizeof(DWORD)),
+                m_desc.Recursive,
+                notifyFilter,
+                nullptr,
+                &overlapped,
+                nullptr))
+            break;
+
+        if (WaitForMultipleObjects(2, handles, FALSE, INFINITE) != WAIT_OBJECT_0)
+        {
+            //~ the kernel still owns buffer and overlapped until the cancelled read completes
+            DWORD ignored = 0;
+            CancelIoEx(m_hDirectory, &overlapped);
+            GetOverlappedResult(m_hDirectory, &overlapped, &ignored, TRUE);
+            break;
+        }
+
+        DWORD bytes = 0;
+        const bool completed = GetOverlappedResult(m_hDirectory, &overlapped, &bytes, FALSE);
+        if (!completed && GetLastError() != ERROR_NOTIFY_ENUM_DIR) break;
+
+        //~ zero bytes means the buffer overflowed and the individual events are gone
+        if (!completed || bytes == 0)
+        {
+            std::scoped_lock lock(m_mutex);
+            m_bOverflow = true;
+            continue;
+        }
+
+        auto cursor = reinterpret_cast<const std::byte*>(buffer.data());
+        for (;;)
+        {
+            const auto& info = *reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(cursor);
+            Enqueue(info);
+            if (info.NextEntryOffset == 0) break;
+            cursor += info.NextEntryOffset;
+        }
+    }
+
+    CloseHandle(overlapped.hEvent);
+}
+
+void FileWatcher::Enqueue(const FILE_NOTIFY_INFORMATION& info)
+{
+    const int wideLength = static_cast<int>(info.FileNameLength / sizeof(WCHAR));
+    const int length     = WideCharToMultiByte(CP_ACP, 0, info.FileName, wideLength, nullptr, 0, nullptr, nullptr);
+    if (length <= 0) return;
+
+    std::string path = m_desc.Directory + '\\';
+    const size_t prefix = path.size();
+    path.resize(prefix + length);
+    WideCharToMultiByte(CP_ACP, 0, info.FileName, wideLength, path.data() + prefix, length, nullptr, nullptr);
+
+    switch (info.Action)
+    {
+        case FILE_ACTION_ADDED:
+        case FILE_ACTION_RENAMED_NEW_NAME: Record(std::move(path), FileChangeAction::Added);    break;
+        case FILE_ACTION_REMOVED:
+        case FILE_ACTION_RENAMED_OLD_NAME: Record(std::move(path), FileChangeAction::Removed);  break;
+        case FILE_ACTION_MODIFIED:         Record(std::move(path), FileChangeAction::Modified); break;
+        default: break;
+    }
+}
+
+void FileWatcher::Record(std::string path, const FileChangeAction action)
+{
+    std::scoped_lock lock(m_mutex);
+
+    const auto now = Clock::now();
+    auto [it, inserted] = m_pending.try_emplace(std::move(path), PENDING_CHANGE{ action, now });
+    if (inserted) return;
+
+    PENDING_CHANGE& change = it->second;
+    change.LastSeen = now;
+
+    //~ collapse the burst into what the consumer actually has to do
+    const FileChangeAction before = change.Action;
+    if (before == FileChangeAction::Added && action == FileChangeAction::Removed)
+    {
+        m_pending.erase(it);    // temp file that came and went
+    }
+    else if (before == FileChangeAction::Removed && action == FileChangeAction::Added)
+    {
+        change.Action = FileChangeAction::Modified; // replaced through a rename, the usual editor save
+    }
+    else if (before != FileChangeAction::Added)
+    {
+        change.Action = action; // writes after a create are still just a new file
+    }
+}
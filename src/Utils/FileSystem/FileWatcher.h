@@ -0,0 +1,81 @@
+#ifndef FILEWATCHER_H
+#define FILEWATCHER_H
+
+#include "Common/DefineWindows.h"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+enum class FileChangeAction : uint8_t
+{
+    Added,
+    Modified,
+    Removed,
+    Overflow    // the OS dropped events, Path is the watched root and the caller should rescan it
+};
+
+typedef struct FILE_CHANGE_EVENT
+{
+    std::string      Path;   // watched directory joined with the relative path
+    FileChangeAction Action;
+} FILE_CHANGE_EVENT;
+
+typedef struct FILE_WATCHER_DESC
+{
+    std::string Directory;
+    bool        Recursive     = true;
+    uint32_t    QuietPeriodMs = 100;        // a path is reported once it has been still this long
+    uint32_t    BufferSize    = 64 * 1024;  // kernel notification buffer, overflow past this
+} FILE_WATCHER_DESC;
+
+/**
+ * @brief Watches a directory tree with overlapped ReadDirectoryChangesW on a background thread.
+ *        Bursts (editors saving through temp files, compilers writing in pieces) are coalesced
+ *        per path, so Poll hands out at most one event per file.
+ */
+class FileWatcher
+{
+public:
+    FileWatcher() = default;
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&)            = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    bool Start(const FILE_WATCHER_DESC& desc);
+    void Stop();
+
+    [[nodiscard]] bool IsRunning() const { return m_watchThread.joinable(); }
+
+    //~ Non-blocking, returns the paths that settled since the last call
+    std::vector<FILE_CHANGE_EVENT> Poll();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct PENDING_CHANGE
+    {
+        FileChangeAction  Action;
+        Clock::time_point LastSeen;
+    };
+
+    void WatchLoop();
+    void Enqueue(const FILE_NOTIFY_INFORMATION& info);
+    void Record(std::string path, FileChangeAction action);
+
+private:
+    FILE_WATCHER_DESC m_desc{};
+    HANDLE            m_hDirectory{ INVALID_HANDLE_VALUE };
+    HANDLE            m_hStopEvent{ nullptr };
+    std::jthread      m_watchThread;
+
+    std::mutex                                      m_mutex;
+    std::unordered_map<std::string, PENDING_CHANGE> m_pending;
+    bool                                            m_bOverflow{ false };
+};
+
+#endif //FILEWATCHER_H
@@ -0,0 +1,56 @@
+#include "MappedFile.h"
+#include "Common/DefineWindows.h"
+
+#include <algorithm>
+#include <utility>
+
+MappedFile::~MappedFile()
+{
+    Unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_pData(std::exchange(other.m_pData, nullptr)),
+      m_nSize(std::exchange(other.m_nSize, 0)),
+      m_bOwnsView(std::exchange(other.m_bOwnsView, true))
+{}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unmap();
+        m_pData = std::exchange(other.m_pData, nullptr);
+        m_nSize = std::exchange(other.m_nSize, 0);
+        m_bOwnsView = std::exchange(other.m_bOwnsView, true);
+    }
+    return *this;
+}
+
+void MappedFile::Prefetch(const size_t offset, size_t length) const
+{
+    if (offset >= m_nSize) return;
+    length = std::min(length, m_nSize - offset);
+    if (length == 0) return;
+
+    WIN32_MEMORY_RANGE_ENTRY range{ const_cast<std::byte*>(m_pData + offset), length };
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+void MappedFile::ApplyHint(const FileAccessHint hint) const
+{
+    switch (hint)
+    {
+    case FileAccessHint::Sequential: Prefetch(0, SEQUENTIAL_PREFETCH); break;
+    case FileAccessHint::WillNeed:   Prefetch(0, m_nSize);             break;
+    default: break;
+    }
+}
+
+void MappedFile::Unmap()
+{
+    if (m_pData && m_bOwnsView) UnmapViewOfFile(m_pData);
+    m_pData = nullptr;
+    m_nSize = 0;
+    m_bOwnsView = true;
+}
@@ -0,0 +1,65 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+//~ Access pattern hint applied when a file is mapped. Windows has no madvise for views and
+//~ FILE_FLAG_SEQUENTIAL_SCAN only tunes cached ReadFile, so both hints are PrefetchVirtualMemory calls
+enum class FileAccessHint : uint8_t
+{
+    None,
+    Sequential, // prefetch the head (MappedFile::SEQUENTIAL_PREFETCH), streaming readers Prefetch ahead of their cursor
+    WillNeed    // fault the whole range in up front
+};
+
+/**
+ * @brief Read-only view over a memory-mapped file, unmapped when it goes out of scope.
+ *        The bytes are the page cache itself, nothing is copied.
+ *        Views handed out by VirtualFileSystem borrow the pack mapping and never unmap it.
+ */
+class MappedFile
+{
+public:
+    static constexpr size_t SEQUENTIAL_PREFETCH = 16 * 1024 * 1024;
+
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    [[nodiscard]] const std::byte* Data () const { return m_pData; }
+    [[nodiscard]] size_t           Size () const { return m_nSize; }
+    [[nodiscard]] bool             Empty() const { return m_nSize == 0; }
+
+    [[nodiscard]] std::span<const std::byte> Bytes() const { return { m_pData, m_nSize }; }
+    [[nodiscard]] std::string_view           Text () const { return { reinterpret_cast<const char*>(m_pData), m_nSize }; }
+
+    [[nodiscard]] const std::byte* begin() const { return m_pData; }
+    [[nodiscard]] const std::byte* end  () const { return m_pData + m_nSize; }
+
+    //~ Asks the OS to start reading [offset, offset + length) in, clipped to the view. Returns at once
+    void Prefetch(size_t offset, size_t length) const;
+
+private:
+    friend class FileSystem;
+    friend class VirtualFileSystem;
+    MappedFile(const std::byte* data, const size_t size, const bool ownsView = true)
+        : m_pData(data), m_nSize(size), m_bOwnsView(ownsView) {}
+
+    void Unmap();
+    void ApplyHint(FileAccessHint hint) const;
+
+private:
+    const std::byte* m_pData{ nullptr };
+    size_t           m_nSize{ 0 };
+    bool             m_bOwnsView{ true };
+};
+
+#endif //MAPPEDFILE_H
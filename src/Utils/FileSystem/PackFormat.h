@@ -0,0 +1,95 @@
+#ifndef PACKFORMAT_H
+#define PACKFORMAT_H
+
+#include "Common/Hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * .fxpk layout (little endian, read through a single read-only mapping):
+ *  [0, sizeof(PACK_HEADER))              PACK_HEADER
+ *  [EntriesOffset, +EntryCount * 32)     PACK_ENTRY, sorted by Hash
+ *  [BucketsOffset, +BucketCount * 4)     open addressing table, entry index + 1, 0 = empty,
+ *                                        linear probing from Hash & (BucketCount - 1)
+ *  [NamesOffset, +NamesSize)             normalized paths, not null terminated
+ *  [first blob, end)                     file contents, every blob starts on BlobAlignment
+ *
+ *  Paths are normalized before hashing: '\' becomes '/', ASCII is lower-cased and leading
+ *  "./" or "/" is dropped, so "Assets\Textures\a.png" and "assets/textures/a.png" are one entry.
+ */
+namespace FoxPack
+{
+    inline constexpr char     FILE_MAGIC[4]    { 'F', 'X', 'P', 'K' };
+    inline constexpr uint16_t FILE_VERSION     { 1 };
+    inline constexpr uint32_t BLOB_ALIGNMENT   { 4096 };
+
+    typedef struct PACK_HEADER
+    {
+        char     Magic[4];
+        uint16_t Version;
+        uint16_t Reserved;
+        uint32_t EntryCount;
+        uint32_t BucketCount;   // power of two, at least twice EntryCount
+        uint32_t BlobAlignment;
+        uint32_t NamesSize;
+        uint64_t EntriesOffset;
+        uint64_t BucketsOffset;
+        uint64_t NamesOffset;
+    } PACK_HEADER;
+
+    typedef struct PACK_ENTRY
+    {
+        uint64_t Hash;
+        uint64_t Offset;        // from the start of the pack
+        uint64_t Size;
+        uint32_t NameOffset;    // into the names block
+        uint32_t NameLength;
+    } PACK_ENTRY;
+
+    static_assert(sizeof(PACK_HEADER) == 48);
+    static_assert(sizeof(PACK_ENTRY)  == 32);
+
+    constexpr char NormalizeChar(const char c)
+    {
+        if (c == '\\') return '/';
+        if (c >= 'A' && c <= 'Z') return static_cast<char>(c - 'A' + 'a');
+        return c;
+    }
+
+    constexpr std::string_view TrimPath(std::string_view path)
+    {
+        for (;;)
+        {
+            if      (path.starts_with("./") || path.starts_with(".\\")) path.remove_prefix(2);
+            else if (path.starts_with('/')  || path.starts_with('\\'))  path.remove_prefix(1);
+            else return path;
+        }
+    }
+
+    //~ FNV-1a over the normalized path, computed on the fly so lookups never allocate
+    constexpr uint64_t HashPath(std::string_view path)
+    {
+        uint64_t hash = FoxHash::FNV_OFFSET_BASIS;
+        for (const char c : TrimPath(path)) hash = FoxHash::Fnv1aStep(hash, NormalizeChar(c));
+        return hash;
+    }
+
+    //~ stored is already normalized, query is whatever the caller passed in
+    constexpr bool PathEquals(const std::string_view stored, std::string_view query)
+    {
+        query = TrimPath(query);
+        if (stored.size() != query.size()) return false;
+        for (size_t i = 0; i < stored.size(); ++i)
+        {
+            if (stored[i] != NormalizeChar(query[i])) return false;
+        }
+        return true;
+    }
+
+    static_assert(HashPath("./Assets\\Textures\\A.png") == HashPath("assets/textures/a.png"));
+    static_assert(HashPath("assets/a.png") == FoxHash::Fnv1a("assets/a.png"));
+}
+
+#endif //PACKFORMAT_H
@@ -0,0 +1,157 @@
+#include "StreamReader.h"
+
+#include <algorithm>
+#include <cstring>
+
+StreamReader::StreamReader(const STREAM_READER_DESC& desc)
+    : m_desc(desc)
+{
+    m_desc.ChunkSize   = std::max<size_t>(m_desc.ChunkSize, 64 * 1024);
+    m_desc.BufferCount = std::max(m_desc.BufferCount, 2u);
+}
+
+StreamReader::~StreamReader()
+{
+    Close();
+}
+
+bool StreamReader::Open(const std::string& path)
+{
+    Close();
+    if (!m_file.OpenForRead(path)) return false;
+
+    m_nFileSize   = m_file.GetFileSize();
+    m_nChunkCount = (m_nFileSize + m_desc.ChunkSize - 1) / m_desc.ChunkSize;
+    m_nConsumed   = 0;
+    m_bFailed     = false;
+
+    // buffers are allocated once and reused for every chunk
+    m_slots.resize(m_desc.BufferCount);
+    for (SLOT& slot : m_slots)
+    {
+        slot.Data.resize(m_desc.ChunkSize);
+        slot.State = SlotState::Free;
+    }
+
+    m_prefetchThread = std::jthread([this](const std::stop_token& token) { PrefetchLoop(token); });
+    return true;
+}
+
+void StreamReader::Close()
+{
+    if (m_prefetchThread.joinable())
+    {
+        m_prefetchThread.request_stop();
+        m_prefetchThread.join();
+    }
+    m_file.Close();
+
+    m_slots.clear();
+    m_current      = {};
+    m_nCursor      = 0;
+    m_bHoldingSlot = false;
+    m_nFileSize    = 0;
+    m_nChunkCount  = 0;
+}
+
+STREAM_CHUNK StreamReader::NextChunk()
+{
+    ReleaseCurrent();
+
+    if (m_nConsumed >= m_nChunkCount || m_slots.empty()) return {};
+
+    SLOT& slot = m_slots[m_nConsumed % m_slots.size()];
+    {
+        std::unique_lock lock(m_mutex);
+        m_cv.wait(lock, [&] { return slot.State == SlotState::Ready || m_bFailed; });
+        if (slot.State != SlotState::Ready) return {};
+    }
+
+    ++m_nConsumed;
+    m_bHoldingSlot = true;
+    m_current      = { slot.Data.data(), slot.Size, slot.Offset };
+    m_nCursor      = m_current.Size; // a whole chunk handed out counts as consumed for Read/Skip
+    return m_current;
+}
+
+size_t StreamReader::Read(void* dest, const size_t size)
+{
+    auto   out    = static_cast<std::byte*>(dest);
+    size_t copied = 0;
+    while (copied < size && RefillCursor())
+    {
+        const size_t n = std::min(size - copied, m_current.Size - m_nCursor);
+        std::memcpy(out + copied, m_current.Data + m_nCursor, n);
+        m_nCursor += n;
+        copied    += n;
+    }
+    return copied;
+}
+
+size_t StreamReader::Skip(const size_t size)
+{
+    size_t skipped = 0;
+    while (skipped < size && RefillCursor())
+    {
+        const size_t n = std::min(size - skipped, m_current.Size - m_nCursor);
+        m_nCursor += n;
+        skipped   += n;
+    }
+    return skipped;
+}
+
+bool StreamReader::RefillCursor()
+{
+    if (m_nCursor < m_current.Size) return true;
+
+    NextChunk();
+    m_nCursor = 0;
+    return !m_current.Empty();
+}
+
+void StreamReader::ReleaseCurrent()
+{
+    if (!m_bHoldingSlot) return;
+
+    {
+        std::scoped_lock lock(m_mutex);
+        m_slots[(m_nConsumed - 1) % m_slots.size()].State = SlotState::Free;
+    }
+    m_bHoldingSlot = false;
+    m_current      = {};
+    m_nCursor      = 0;
+    m_cv.notify_all();
+}
+
+void StreamReader::PrefetchLoop(const std::stop_token& stopToken)
+{
+    for (uint64_t chunk = 0; chunk < m_nChunkCount; ++chunk)
+    {
+        SLOT& slot = m_slots[chunk % m_slots.size()];
+        {
+            std::unique_lock lock(m_mutex);
+            if (!m_cv.wait(lock, stopToken, [&] { return slot.State == SlotState::Free; })) return;
+        }
+
+        // the file is only ever read from this thread, so plain sequential reads are enough
+        const uint64_t offset = chunk * m_desc.ChunkSize;
+        const size_t   size   = static_cast<size_t>(std::min<uint64_t>(m_desc.ChunkSize, m_nFileSize - offset));
+        const bool     ok     = m_file.ReadBytes(slot.Data.data(), size);
+
+        {
+            std::scoped_lock lock(m_mutex);
+            if (!ok)
+            {
+                m_bFailed = true;
+            }
+            else
+            {
+                slot.Size   = size;
+                slot.Offset = offset;
+                slot.State  = SlotState::Ready;
+            }
+        }
+        m_cv.notify_all();
+        if (!ok) return;
+    }
+}
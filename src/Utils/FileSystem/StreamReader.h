@@ -0,0 +1,97 @@
+#ifndef STREAMREADER_H
+#define STREAMREADER_H
+
+#include "FileSystem.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef struct STREAM_READER_DESC
+{
+    size_t   ChunkSize   = 4 * 1024 * 1024;
+    uint32_t BufferCount = 2; // rotating buffers, BufferCount - 1 chunks are read ahead of the consumer
+} STREAM_READER_DESC;
+
+//~ One chunk handed to the consumer, valid until the next NextChunk/Read call
+typedef struct STREAM_CHUNK
+{
+    const std::byte* Data  { nullptr };
+    size_t           Size  { 0 };
+    uint64_t         Offset{ 0 };  // file position of Data[0]
+
+    [[nodiscard]] bool                       Empty() const { return Size == 0; }
+    [[nodiscard]] std::span<const std::byte> Bytes() const { return { Data, Size }; }
+} STREAM_CHUNK;
+
+/**
+ * @brief Pull-style chunked reader for files that should never be resident as a whole.
+ *        A background thread fills the next buffers while the caller parses the current one,
+ *        peak memory is ChunkSize * BufferCount regardless of the file size.
+ */
+class StreamReader
+{
+public:
+    explicit StreamReader(const STREAM_READER_DESC& desc = {});
+    ~StreamReader();
+
+    StreamReader(const StreamReader&)            = delete;
+    StreamReader& operator=(const StreamReader&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    //~ Blocks until the next chunk is read, Empty() at the end of the file or on a read error
+    STREAM_CHUNK NextChunk();
+
+    //~ Copies exactly size bytes across chunk boundaries (headers, records), returns bytes copied
+    size_t Read(void* dest, size_t size);
+
+    //~ Skips bytes without copying them
+    size_t Skip(size_t size);
+
+    [[nodiscard]] uint64_t GetFileSize() const { return m_nFileSize; }
+    [[nodiscard]] bool     HasFailed  () const { return m_bFailed; }
+
+private:
+    enum class SlotState : uint8_t { Free, Ready };
+
+    struct SLOT
+    {
+        std::vector<std::byte> Data;
+        size_t                 Size  { 0 };
+        uint64_t               Offset{ 0 };
+        SlotState              State { SlotState::Free };
+    };
+
+    void PrefetchLoop(const std::stop_token& stopToken);
+    void ReleaseCurrent();
+
+    //~ Moves to the next chunk once Read/Skip used up the current one
+    bool RefillCursor();
+
+private:
+    STREAM_READER_DESC          m_desc;
+    FileSystem                  m_file{};
+    std::vector<SLOT>           m_slots;
+    std::mutex                  m_mutex;
+    std::condition_variable_any m_cv;
+    std::jthread                m_prefetchThread;
+
+    uint64_t m_nFileSize    { 0 };
+    uint64_t m_nChunkCount  { 0 };
+    uint64_t m_nConsumed    { 0 };  // chunks handed to the consumer
+    bool     m_bHoldingSlot { false };
+
+    std::atomic<bool> m_bFailed{ false };
+
+    STREAM_CHUNK m_current{};
+    size_t       m_nCursor{ 0 };  // bytes of m_current already handed out by Read/Skip
+};
+
+#endif //STREAMREADER_H
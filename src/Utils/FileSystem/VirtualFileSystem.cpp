@@ -0,0 +1,172 @@
+#include "VirtualFileSystem.h"
+#include "Logger/Logger.h"
+
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+    //~ [offset, offset + length) within [0, size), written so that no sum can wrap around
+    constexpr bool FitsInside(const uint64_t offset, const uint64_t length, const uint64_t size)
+    {
+        return offset <= size && length <= size - offset;
+    }
+}
+
+bool VirtualFileSystem::Mount(const std::string& packPath)
+{
+    if (!FileSystem::IsFile(packPath)) return false;
+
+    MOUNTED_PACK pack{};
+    pack.Path = packPath;
+    pack.File = FileSystem::MapFile(packPath);
+
+    const std::byte* base = pack.File.Data();
+    const size_t     size = pack.File.Size();
+
+    FoxPack::PACK_HEADER header{};
+    if (size < sizeof(header))
+    {
+        LOG_WARNING("[VFS] {} is too small to be a pack", packPath);
+        return false;
+    }
+    std::memcpy(&header, base, sizeof(header));
+
+    if (std::memcmp(header.Magic, FoxPack::FILE_MAGIC, sizeof(header.Magic)) != 0 ||
+        header.Version != FoxPack::FILE_VERSION)
+    {
+        LOG_WARNING("[VFS] {} is not a version {} pack", packPath, FoxPack::FILE_VERSION);
+        return false;
+    }
+
+    //~ every table has to sit inside the mapping, a truncated or corrupt pack must not fault later.
+    //~ Counts are 32 bit so the lengths can't wrap, the offsets can: never add them to anything
+    const bool powerOfTwo = header.BucketCount != 0 && (header.BucketCount & (header.BucketCount - 1)) == 0;
+    if (!powerOfTwo || header.BucketCount <= header.EntryCount ||
+        !FitsInside(header.EntriesOffset, uint64_t{ header.EntryCount } * sizeof(FoxPack::PACK_ENTRY), size) ||
+        !FitsInside(header.BucketsOffset, uint64_t{ header.BucketCount } * sizeof(uint32_t), size) ||
+        !FitsInside(header.NamesOffset,   header.NamesSize, size) ||
+        header.EntriesOffset % alignof(FoxPack::PACK_ENTRY) != 0 || header.BucketsOffset % alignof(uint32_t) != 0)
+    {
+        LOG_WARNING("[VFS] {} has a corrupt table of contents", packPath);
+        return false;
+    }
+
+    pack.Entries    = reinterpret_cast<const FoxPack::PACK_ENTRY*>(base + header.EntriesOffset);
+    pack.Buckets    = reinterpret_cast<const uint32_t*>(base + header.BucketsOffset);
+    pack.Names      = reinterpret_cast<const char*>(base + header.NamesOffset);
+    pack.EntryCount = header.EntryCount;
+    pack.BucketMask = header.BucketCount - 1;
+
+    for (uint32_t i = 0; i < pack.EntryCount; ++i)
+    {
+        const FoxPack::PACK_ENTRY& entry = pack.Entries[i];
+        if (!FitsInside(entry.Offset, entry.Size, size) || !FitsInside(entry.NameOffset, entry.NameLength, header.NamesSize))
+        {
+            LOG_WARNING("[VFS] {} has an entry pointing outside the pack", packPath);
+            return false;
+        }
+    }
+
+    //~ the TOC is hit on every lookup, fault it in now instead of on the first asset load
+    WIN32_MEMORY_RANGE_ENTRY range{ const_cast<std::byte*>(base), static_cast<SIZE_T>(header.NamesOffset + header.NamesSize) };
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+
+    LOG_INFO("[VFS] Mounted {} ({} files)", packPath, pack.EntryCount);
+
+    std::unique_lock lock(m_mutex);
+    m_packs.push_back(std::move(pack));
+    return true;
+}
+
+void VirtualFileSystem::UnmountAll()
+{
+    std::unique_lock lock(m_mutex);
+    m_packs.clear();
+}
+
+void VirtualFileSystem::SetLooseRoot(const std::string& root)
+{
+    std::unique_lock lock(m_mutex);
+    m_szLooseRoot = root;
+    if (!m_szLooseRoot.empty() && m_szLooseRoot.back() != '\\' && m_szLooseRoot.back() != '/')
+        m_szLooseRoot += '\\';
+}
+
+bool VirtualFileSystem::IsPacked(const std::string_view path)
+{
+    std::shared_lock lock(m_mutex);
+    const MOUNTED_PACK*        pack  = nullptr;
+    const FoxPack::PACK_ENTRY* entry = nullptr;
+    return FindPacked(path, pack, entry);
+}
+
+bool VirtualFileSystem::Exists(const std::string_view path)
+{
+    if (IsPacked(path)) return true;
+
+    std::shared_lock lock(m_mutex);
+    return FileSystem::IsFile(LoosePath(path));
+}
+
+MappedFile VirtualFileSystem::Open(const std::string_view path, const FileAccessHint hint)
+{
+    std::string loosePath;
+    {
+        std::shared_lock lock(m_mutex);
+
+        const MOUNTED_PACK*        pack  = nullptr;
+        const FoxPack::PACK_ENTRY* entry = nullptr;
+        if (FindPacked(path, pack, entry))
+        {
+            MappedFile view{ pack->File.Data() + entry->Offset, static_cast<size_t>(entry->Size), false };
+            view.ApplyHint(hint);
+            return view;
+        }
+        loosePath = LoosePath(path);
+    }
+    return FileSystem::MapFile(loosePath, hint);
+}
+
+std::vector<char> VirtualFileSystem::ReadFile(const std::string_view path)
+{
+    const MappedFile file = Open(path, FileAccessHint::Sequential);
+    const auto       data = reinterpret_cast<const char*>(file.Data());
+    return { data, data + file.Size() };
+}
+
+const FoxPack::PACK_ENTRY* VirtualFileSystem::Find(const MOUNTED_PACK& pack, const std::string_view path, const uint64_t hash)
+{
+    uint32_t bucket = static_cast<uint32_t>(hash) & pack.BucketMask;
+    for (uint32_t probe = 0; probe <= pack.BucketMask; ++probe, bucket = (bucket + 1) & pack.BucketMask)
+    {
+        const uint32_t slot = pack.Buckets[bucket];
+        if (slot == 0 || slot > pack.EntryCount) return nullptr;
+
+        const FoxPack::PACK_ENTRY& entry = pack.Entries[slot - 1];
+        if (entry.Hash == hash &&
+            FoxPack::PathEquals({ pack.Names + entry.NameOffset, entry.NameLength }, path))
+            return &entry;
+    }
+    return nullptr;
+}
+
+bool VirtualFileSystem::FindPacked(const std::string_view path, const MOUNTED_PACK*& outPack, const FoxPack::PACK_ENTRY*& outEntry)
+{
+    const uint64_t hash = FoxPack::HashPath(path);
+    for (auto it = m_packs.rbegin(); it != m_packs.rend(); ++it)
+    {
+        if (const FoxPack::PACK_ENTRY* entry = Find(*it, path, hash))
+        {
+            outPack  = &*it;
+            outEntry = entry;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string VirtualFileSystem::LoosePath(const std::string_view path)
+{
+    return m_szLooseRoot + std::string(path);
+}
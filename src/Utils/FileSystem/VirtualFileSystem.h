@@ -0,0 +1,59 @@
+#ifndef VIRTUALFILESYSTEM_H
+#define VIRTUALFILESYSTEM_H
+
+#include "FileSystem.h"
+#include "PackFormat.h"
+
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Resolves asset paths through mounted .fxpk packs first and falls back to loose files.
+ *        A pack hit is one hash probe into the mapped table of contents, no syscalls at all.
+ *        Views into a pack stay valid until that pack is unmounted.
+ */
+class VirtualFileSystem
+{
+public:
+    //~ Later mounts shadow earlier ones, false if the pack is missing or malformed
+    static bool Mount(const std::string& packPath);
+    static void UnmountAll();
+
+    //~ Loose files resolve against this directory, empty means the working directory
+    static void SetLooseRoot(const std::string& root);
+
+    [[nodiscard]] static bool IsPacked(std::string_view path);
+    [[nodiscard]] static bool Exists  (std::string_view path);
+
+    //~ Throws like FileSystem::MapFile when the path is neither packed nor on disk
+    static MappedFile        Open    (std::string_view path, FileAccessHint hint = FileAccessHint::None);
+    static std::vector<char> ReadFile(std::string_view path);
+
+private:
+    struct MOUNTED_PACK
+    {
+        std::string                Path;
+        MappedFile                 File;
+        const FoxPack::PACK_ENTRY* Entries    { nullptr };
+        const uint32_t*            Buckets    { nullptr };
+        const char*                Names      { nullptr };
+        uint32_t                   EntryCount { 0 };
+        uint32_t                   BucketMask { 0 };
+    };
+
+    static const FoxPack::PACK_ENTRY* Find(const MOUNTED_PACK& pack, std::string_view path, uint64_t hash);
+
+    //~ Caller holds m_mutex, searches the newest mount first
+    static bool FindPacked(std::string_view path, const MOUNTED_PACK*& outPack, const FoxPack::PACK_ENTRY*& outEntry);
+
+    static std::string LoosePath(std::string_view path);
+
+private:
+    inline static std::shared_mutex         m_mutex{};
+    inline static std::vector<MOUNTED_PACK> m_packs{};
+    inline static std::string               m_szLooseRoot{};
+};
+
+#endif //VIRTUALFILESYSTEM_H
@@ -0,0 +1,221 @@
+#ifndef BINARYLOG_H
+#define BINARYLOG_H
+
+#include "LogTypes.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * .binlog layout (little endian):
+ *  BINLOG_FILE_HEADER, then a stream of records.
+ *  Every record starts with { uint8 Kind, uint16 Size } where Size covers the whole record.
+ *
+ *  Define     : varint Id, uint8 Level, varint Line, str File, str Format
+ *  Message    : varint Id, uint64 Ticks, uint32 ThreadId, args...
+ *  ScopeBegin : uint64 Ticks, uint32 ThreadId, uint8 HasNext, str Name
+ *  ScopeEnd   : uint64 Ticks, uint32 ThreadId
+ *  Tab        : uint64 Ticks, uint32 ThreadId, int8 Delta
+ *  Text       : uint64 Ticks, uint32 ThreadId, uint8 Level, str Text   (already formatted)
+ *
+ *  str = varint length + bytes, args = uint8 ArgType + payload
+ *  Types with a user std::formatter are formatted with "{}" at the call site and stored as String.
+ */
+namespace BinLog
+{
+    inline constexpr char     FILE_MAGIC[4]    { 'F', 'X', 'B', 'L' };
+    inline constexpr uint16_t FILE_VERSION     { 1 };
+    inline constexpr size_t   RECORD_HEADER_SIZE{ 3 };
+    inline constexpr size_t   PREFORMATTED_ARG_CAPACITY{ 128 }; // user-formatted args are clipped to this
+
+    enum class RecordKind: uint8_t
+    {
+        Define = 1,
+        Message,
+        ScopeBegin,
+        ScopeEnd,
+        Tab,
+        Text
+    };
+
+    enum class ArgType: uint8_t
+    {
+        Int = 1, // zigzag varint
+        UInt,    // varint
+        Float,   // raw double
+        Bool,
+        Char,
+        String,  // varint length + bytes
+        Pointer  // raw uint64
+    };
+
+#pragma pack(push, 1)
+    typedef struct BINLOG_FILE_HEADER
+    {
+        char     Magic[4];
+        uint16_t Version;
+        uint8_t  IndentStyle;
+        uint8_t  Reserved;
+        uint64_t TickFrequency;   // ticks per second
+        uint64_t StartTicks;      // tick value at StartUnixMicros
+        int64_t  StartUnixMicros;
+    } BINLOG_FILE_HEADER;
+#pragma pack(pop)
+
+    /** Bounded byte writer over a caller-provided buffer, never allocates */
+    typedef struct BINLOG_WRITER
+    {
+        char*  Data;
+        size_t Capacity;
+        size_t Size{ 0 };
+        size_t RecordStart{ 0 };
+        bool   Truncated{ false };
+
+        size_t Remaining() const { return Capacity - Size; }
+
+        bool PutBytes(const void* src, const size_t n)
+        {
+            if (n > Remaining()) { Truncated = true; return false; }
+            std::memcpy(Data + Size, src, n);
+            Size += n;
+            return true;
+        }
+
+        template<typename T>
+        bool Put(const T value) { return PutBytes(&value, sizeof(T)); }
+
+        bool PutVarint(uint64_t value)
+        {
+            uint8_t bytes[10];
+            size_t n = 0;
+            do
+            {
+                uint8_t b = value & 0x7F;
+                value >>= 7;
+                if (value) b |= 0x80;
+                bytes[n++] = b;
+            } while (value);
+            return PutBytes(bytes, n);
+        }
+
+        bool PutString(std::string_view text)
+        {
+            // leave room for the length prefix, clip the payload instead of dropping it
+            constexpr size_t maxPrefix = 3;
+            if (Remaining() < maxPrefix) { Truncated = true; return false; }
+            if (text.size() > Remaining() - maxPrefix)
+            {
+                text = text.substr(0, Remaining() - maxPrefix);
+                Truncated = true;
+            }
+            return PutVarint(text.size()) && PutBytes(text.data(), text.size());
+        }
+
+        void BeginRecord(const RecordKind kind)
+        {
+            RecordStart = Size;
+            Put(static_cast<uint8_t>(kind));
+            Put(uint16_t{ 0 });
+        }
+
+        //~ Patches the size field, returns the finished record
+        std::string_view EndRecord()
+        {
+            const auto size = static_cast<uint16_t>(Size - RecordStart);
+            if (RecordStart + RECORD_HEADER_SIZE <= Size)
+                std::memcpy(Data + RecordStart + 1, &size, sizeof(size));
+            return { Data + RecordStart, Size - RecordStart };
+        }
+    } BINLOG_WRITER;
+
+    inline uint64_t ZigZag(const int64_t v)
+    {
+        return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+    }
+
+    inline int64_t UnZigZag(const uint64_t v)
+    {
+        return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+    }
+
+    //~ Stores the raw value with a type tag, formatting is deferred to the decoder
+    template<typename T>
+    void EncodeArg(BINLOG_WRITER& w, const T& value)
+    {
+        using U = std::remove_cvref_t<T>;
+        using D = std::decay_t<U>;
+
+        if constexpr (std::is_same_v<U, bool>)
+        {
+            w.Put(static_cast<uint8_t>(ArgType::Bool));
+            w.Put(static_cast<uint8_t>(value ? 1 : 0));
+        }
+        else if constexpr (std::is_same_v<U, char>)
+        {
+            w.Put(static_cast<uint8_t>(ArgType::Char));
+            w.Put(value);
+        }
+        else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+        {
+            w.Put(static_cast<uint8_t>(ArgType::Int));
+            w.PutVarint(ZigZag(static_cast<int64_t>(value)));
+        }
+        else if constexpr (std::is_integral_v<U>)
+        {
+            w.Put(static_cast<uint8_t>(ArgType::UInt));
+            w.PutVarint(static_cast<uint64_t>(value));
+        }
+        else if constexpr (std::is_floating_point_v<U>)
+        {
+            w.Put(static_cast<uint8_t>(ArgType::Float));
+            w.Put(static_cast<double>(value));
+        }
+        else if constexpr (std::is_same_v<D, const char*> || std::is_same_v<D, char*>)
+        {
+            w.Put(static_cast<uint8_t>(ArgType::String));
+            w.PutString(value ? std::string_view{ value } : std::string_view{ "(null)" });
+        }
+        else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+        {
+            w.Put(static_cast<uint8_t>(ArgType::String));
+            w.PutString(std::string_view{ value });
+        }
+        else if constexpr (std::is_pointer_v<U> || std::is_null_pointer_v<U>)
+        {
+            w.Put(static_cast<uint8_t>(ArgType::Pointer));
+            w.Put(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+        }
+        else if constexpr (std::is_default_constructible_v<std::formatter<U, char>>)
+        {
+            // user formatters go through "{}" into a stack buffer and travel as a string, the call site's
+            // format spec is lost (the decoder falls back to "{}") but any LOG_* call that formats still compiles
+            char text[PREFORMATTED_ARG_CAPACITY];
+            const auto result = std::format_to_n(text, sizeof(text), "{}", value);
+            w.Put(static_cast<uint8_t>(ArgType::String));
+            w.PutString({ text, std::min(static_cast<size_t>(result.size), sizeof(text)) });
+        }
+        else
+        {
+            static_assert(sizeof(T) == 0, "binary log arguments must be formattable");
+        }
+    }
+}
+
+/** Static per call site identity, the format string is registered once on first use */
+typedef struct LOG_CALL_SITE
+{
+    const char*           File;
+    uint32_t              Line;
+    std::atomic<uint32_t> Id{ 0 };         // .binlog format id
+    std::atomic<uint32_t> RecorderId{ 0 }; // flight recorder format id
+
+    constexpr LOG_CALL_SITE(const char* file, const uint32_t line): File(file), Line(line) {}
+} LOG_CALL_SITE;
+
+#endif //BINARYLOG_H
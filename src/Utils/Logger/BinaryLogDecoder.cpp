@@ -0,0 +1,340 @@
+#include "BinaryLogDecoder.h"
+
+#include <cstring>
+#include <format>
+#include <variant>
+
+namespace
+{
+    /** Bounds-checked cursor over a record payload */
+    struct BYTE_READER
+    {
+        std::string_view Bytes;
+        size_t           Offset{ 0 };
+        bool             Failed{ false };
+
+        bool AtEnd() const { return Offset >= Bytes.size(); }
+
+        template<typename T>
+        T Get()
+        {
+            T value{};
+            if (Offset + sizeof(T) > Bytes.size()) { Failed = true; return value; }
+            std::memcpy(&value, Bytes.data() + Offset, sizeof(T));
+            Offset += sizeof(T);
+            return value;
+        }
+
+        uint64_t GetVarint()
+        {
+            uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                if (AtEnd()) { Failed = true; return value; }
+                const auto b = static_cast<uint8_t>(Bytes[Offset++]);
+                value |= static_cast<uint64_t>(b & 0x7F) << shift;
+                if (!(b & 0x80)) return value;
+            }
+            Failed = true;
+            return value;
+        }
+
+        std::string_view GetString()
+        {
+            const uint64_t length = GetVarint();
+            if (Failed || Offset + length > Bytes.size()) { Failed = true; return {}; }
+            const std::string_view text = Bytes.substr(Offset, length);
+            Offset += length;
+            return text;
+        }
+    };
+
+    using ARG_VALUE = std::variant<int64_t, uint64_t, double, bool, char, std::string_view, const void*>;
+
+    bool ReadArg(BYTE_READER& reader, ARG_VALUE& out)
+    {
+        switch (static_cast<BinLog::ArgType>(reader.Get<uint8_t>()))
+        {
+        case BinLog::ArgType::Int:     out = BinLog::UnZigZag(reader.GetVarint()); break;
+        case BinLog::ArgType::UInt:    out = reader.GetVarint(); break;
+        case BinLog::ArgType::Float:   out = reader.Get<double>(); break;
+        case BinLog::ArgType::Bool:    out = reader.Get<uint8_t>() != 0; break;
+        case BinLog::ArgType::Char:    out = reader.Get<char>(); break;
+        case BinLog::ArgType::String:  out = reader.GetString(); break;
+        case BinLog::ArgType::Pointer: out = reinterpret_cast<const void*>(static_cast<uintptr_t>(reader.Get<uint64_t>())); break;
+        default: return false;
+        }
+        return !reader.Failed;
+    }
+
+    void FormatArg(std::string& out, const std::string_view spec, const ARG_VALUE& arg)
+    {
+        const std::string fmt = std::format("{{{}}}", spec);
+        try
+        {
+            std::visit([&](const auto& value)
+            {
+                std::vformat_to(std::back_inserter(out), fmt, std::make_format_args(value));
+            }, arg);
+        }
+        catch (const std::format_error&)
+        {
+            // spec doesn't fit the stored type, still show the value
+            std::visit([&](const auto& value)
+            {
+                std::vformat_to(std::back_inserter(out), "{}", std::make_format_args(value));
+            }, arg);
+        }
+    }
+
+    size_t ParseIndex(const std::string_view digits)
+    {
+        size_t index = 0;
+        for (const char digit : digits) index = index * 10 + static_cast<size_t>(digit - '0');
+        return index;
+    }
+
+    //~ Matching '}' for the '{' at open, dynamic width/precision ("{:{}.{}}") nest one level deep
+    size_t FindFieldEnd(const std::string_view fmt, const size_t open)
+    {
+        size_t depth = 0;
+        for (size_t i = open; i < fmt.size(); ++i)
+        {
+            if (fmt[i] == '{') ++depth;
+            else if (fmt[i] == '}' && --depth == 0) return i;
+        }
+        return std::string_view::npos;
+    }
+
+    //~ Replaces nested "{}" / "{n}" in a spec with the integer they refer to, in std::format's order:
+    //~ the field's own argument was taken first, nested ones follow left to right
+    std::string ResolveSpec(const std::string_view spec, const std::vector<ARG_VALUE>& args, size_t& nextArg)
+    {
+        std::string resolved;
+        for (size_t i = 0; i < spec.size(); ++i)
+        {
+            if (spec[i] != '{')
+            {
+                resolved += spec[i];
+                continue;
+            }
+
+            const size_t close = spec.find('}', i);
+            if (close == std::string_view::npos) return std::string(spec);
+
+            const std::string_view digits = spec.substr(i + 1, close - i - 1);
+            const size_t argIndex = digits.empty() ? nextArg++ : ParseIndex(digits);
+
+            // anything but an integer makes the spec invalid, FormatArg then falls back to "{}"
+            if (argIndex < args.size())
+            {
+                if      (const auto* s = std::get_if<int64_t>(&args[argIndex]))  resolved += std::to_string(*s);
+                else if (const auto* u = std::get_if<uint64_t>(&args[argIndex])) resolved += std::to_string(*u);
+                else resolved += '?';
+            }
+            else resolved += '?';
+
+            i = close;
+        }
+        return resolved;
+    }
+}
+
+std::string BinaryLogDecoder::FormatRecord(const std::string_view fmt, const std::string_view argBytes)
+{
+    std::vector<ARG_VALUE> args;
+    BYTE_READER reader{ argBytes };
+    while (!reader.AtEnd())
+    {
+        ARG_VALUE value;
+        if (!ReadArg(reader, value)) break;
+        args.push_back(value);
+    }
+
+    std::string out;
+    out.reserve(fmt.size() + 32);
+
+    size_t nextArg = 0;
+    for (size_t i = 0; i < fmt.size(); ++i)
+    {
+        const char ch = fmt[i];
+        if (ch == '}' && i + 1 < fmt.size() && fmt[i + 1] == '}') { out += '}'; ++i; continue; }
+        if (ch != '{') { out += ch; continue; }
+        if (i + 1 < fmt.size() && fmt[i + 1] == '{') { out += '{'; ++i; continue; }
+
+        const size_t close = FindFieldEnd(fmt, i);
+        if (close == std::string_view::npos) { out.append(fmt.substr(i)); break; }
+
+        // "{index:spec}" -> explicit index is optional, nested width/precision fields are resolved first
+        const std::string_view field = fmt.substr(i + 1, close - i - 1);
+        const size_t colon = field.find(':');
+        const std::string_view index = field.substr(0, colon);
+
+        const size_t      argIndex = index.empty() ? nextArg++ : ParseIndex(index);
+        const std::string spec     = colon == std::string_view::npos ? std::string{} : ResolveSpec(field.substr(colon), args, nextArg);
+
+        if (argIndex < args.size()) FormatArg(out, spec, args[argIndex]);
+        else                        out += "{?}";
+
+        i = close;
+    }
+    return out;
+}
+
+bool BinaryLogDecoder::Decode(const std::string_view bytes, std::string& out)
+{
+    if (bytes.size() < sizeof(m_header))
+    {
+        m_szError = "File is smaller than the binlog header";
+        return false;
+    }
+
+    std::memcpy(&m_header, bytes.data(), sizeof(m_header));
+    if (std::memcmp(m_header.Magic, BinLog::FILE_MAGIC, sizeof(m_header.Magic)) != 0)
+    {
+        m_szError = "Not a binlog file (bad magic)";
+        return false;
+    }
+    if (m_header.Version != BinLog::FILE_VERSION)
+    {
+        m_szError = std::format("Unsupported binlog version {}", m_header.Version);
+        return false;
+    }
+
+    size_t offset = sizeof(m_header);
+    while (offset + BinLog::RECORD_HEADER_SIZE <= bytes.size())
+    {
+        const auto kind = static_cast<BinLog::RecordKind>(bytes[offset]);
+        uint16_t size = 0;
+        std::memcpy(&size, bytes.data() + offset + 1, sizeof(size));
+
+        if (size < BinLog::RECORD_HEADER_SIZE || offset + size > bytes.size())
+        {
+            // a crash can leave a torn record at the tail, everything before it is still good
+            m_szError = std::format("Truncated record at offset {}", offset);
+            break;
+        }
+
+        BYTE_READER reader{ bytes.substr(offset + BinLog::RECORD_HEADER_SIZE, size - BinLog::RECORD_HEADER_SIZE) };
+        offset += size;
+
+        switch (kind)
+        {
+        case BinLog::RecordKind::Define:
+        {
+            const auto id = static_cast<uint32_t>(reader.GetVarint());
+            CALL_SITE_DEF def{};
+            def.Level = static_cast<LogLevel>(reader.Get<uint8_t>());
+            reader.GetVarint();   // line
+            reader.GetString();   // file
+            def.Format = reader.GetString();
+            if (!reader.Failed) m_callSites[id] = std::move(def);
+            break;
+        }
+        case BinLog::RecordKind::Message:
+        {
+            const auto id       = static_cast<uint32_t>(reader.GetVarint());
+            const auto ticks    = reader.Get<uint64_t>();
+            const auto threadId = reader.Get<uint32_t>();
+            if (reader.Failed) break;
+
+            const auto it = m_callSites.find(id);
+            if (it == m_callSites.end())
+            {
+                AppendLine(out, ticks, threadId, LogLevel::Print, std::format("<unknown call site {}>", id), false);
+                break;
+            }
+            AppendLine(out, ticks, threadId, it->second.Level,
+                       FormatRecord(it->second.Format, reader.Bytes.substr(reader.Offset)), false);
+            break;
+        }
+        case BinLog::RecordKind::ScopeBegin:
+        {
+            const auto ticks    = reader.Get<uint64_t>();
+            const auto threadId = reader.Get<uint32_t>();
+            const bool hasNext  = reader.Get<uint8_t>() != 0;
+            const auto name     = reader.GetString();
+            if (reader.Failed) break;
+
+            AppendLine(out, ticks, threadId, LogLevel::Print, name, true);
+            m_threads[threadId].ScopeHasNext.push_back(hasNext);
+            break;
+        }
+        case BinLog::RecordKind::ScopeEnd:
+        {
+            reader.Get<uint64_t>();
+            const auto threadId = reader.Get<uint32_t>();
+            if (reader.Failed) break;
+
+            auto& scopes = m_threads[threadId].ScopeHasNext;
+            if (!scopes.empty()) scopes.pop_back();
+            break;
+        }
+        case BinLog::RecordKind::Tab:
+        {
+            reader.Get<uint64_t>();
+            const auto threadId = reader.Get<uint32_t>();
+            const auto delta    = reader.Get<int8_t>();
+            if (reader.Failed) break;
+
+            uint32_t& tabs = m_threads[threadId].Tabs;
+            if (delta > 0) ++tabs;
+            else if (tabs > 0) --tabs;
+            break;
+        }
+        case BinLog::RecordKind::Text:
+        {
+            const auto ticks    = reader.Get<uint64_t>();
+            const auto threadId = reader.Get<uint32_t>();
+            const auto level    = static_cast<LogLevel>(reader.Get<uint8_t>());
+            const auto text     = reader.GetString();
+            if (!reader.Failed) AppendLine(out, ticks, threadId, level, text, false);
+            break;
+        }
+        default:
+            // unknown kinds are skipped thanks to the size field
+            break;
+        }
+    }
+    return true;
+}
+
+void BinaryLogDecoder::AppendPrefix(std::string& out, const THREAD_STATE& state, const bool isNodeLine) const
+{
+    const LOG_INDENT_GLYPHS& g = GetIndentGlyphs(static_cast<IndentStyle>(m_header.IndentStyle));
+    const auto& scopes = state.ScopeHasNext;
+    if (scopes.empty()) return;
+
+    for (size_t i = 0; i + 1 < scopes.size(); ++i)
+        out.append(scopes[i] ? g.V : g.SP);
+
+    if (isNodeLine) out.append(scopes.back() ? g.T : g.L);
+    else            out.append(scopes.back() ? g.V : g.SP);
+}
+
+void BinaryLogDecoder::AppendLine(
+    std::string& out,
+    const uint64_t ticks,
+    const uint32_t threadId,
+    const LogLevel level,
+    const std::string_view text,
+    const bool isNodeLine)
+{
+    if (m_desc.ShowTimestamps && m_header.TickFrequency)
+    {
+        const double seconds = static_cast<double>(static_cast<int64_t>(ticks - m_header.StartTicks)) /
+                               static_cast<double>(m_header.TickFrequency);
+        std::format_to(std::back_inserter(out), "[+{:.6f}] ", seconds);
+    }
+    if (m_desc.ShowThreadIds) std::format_to(std::back_inserter(out), "[T{}] ", threadId);
+
+    const THREAD_STATE& state = m_threads[threadId];
+
+    // same layout as Logger: tree prefix, tabs, level tag, then the node glyph for scope headers
+    AppendPrefix(out, state, false);
+    out.append(state.Tabs, '\t');
+    out.append(GetLevelPrefix(isNodeLine ? LogLevel::Print : level));
+    if (isNodeLine) AppendPrefix(out, state, true);
+    out.append(text);
+    out += '\n';
+}
@@ -0,0 +1,60 @@
+#ifndef BINARYLOGDECODER_H
+#define BINARYLOGDECODER_H
+
+#include "Common/Core.h"
+#include "BinaryLog.h"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+typedef struct BINLOG_DECODE_DESC
+{
+    bool ShowTimestamps = false; // "[+seconds]" relative to the start of the log
+    bool ShowThreadIds  = false;
+} BINLOG_DECODE_DESC;
+
+/**
+ * @brief Turns .binlog bytes back into the tree-style text the live logger prints.
+ *        Platform independent so it can run inside the offline tools.
+ */
+class BinaryLogDecoder
+{
+public:
+    explicit BinaryLogDecoder(const BINLOG_DECODE_DESC& desc = {}) : m_desc(desc) {}
+
+    //~ Appends the decoded text to out, false if the header is unusable
+    bool Decode(std::string_view bytes, std::string& out);
+
+    _fox_Return_enforce const std::string& GetError() const { return m_szError; }
+
+    //~ Formats fmt with type-tagged arguments read from the record payload
+    static std::string FormatRecord(std::string_view fmt, std::string_view argBytes);
+
+private:
+    struct CALL_SITE_DEF
+    {
+        LogLevel    Level{ LogLevel::Print };
+        std::string Format;
+    };
+
+    struct THREAD_STATE
+    {
+        std::vector<bool> ScopeHasNext;
+        uint32_t          Tabs{ 0 };
+    };
+
+    void AppendPrefix(std::string& out, const THREAD_STATE& state, bool isNodeLine) const;
+    void AppendLine  (std::string& out, uint64_t ticks, uint32_t threadId, LogLevel level,
+                      std::string_view text, bool isNodeLine);
+
+private:
+    BINLOG_DECODE_DESC                           m_desc;
+    BinLog::BINLOG_FILE_HEADER                   m_header{};
+    std::unordered_map<uint32_t, CALL_SITE_DEF>  m_callSites;
+    std::unordered_map<uint32_t, THREAD_STATE>   m_threads;
+    std::string                                  m_szError;
+};
+
+#endif //BINARYLOGDECODER_H
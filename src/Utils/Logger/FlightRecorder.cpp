@@ -0,0 +1,194 @@
+#include "FlightRecorder.h"
+#include "Logger.h"
+#include "FileSystem/FileSystem.h"
+#include "Timer/FastClock.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+
+std::unique_ptr<FlightRecorder> FlightRecorder::m_pInstance = nullptr;
+
+bool FlightRecorder::Initialize(const FLIGHT_RECORDER_DESC& desc)
+{
+    if (m_pInstance) return true;
+
+    auto recorder = std::unique_ptr<FlightRecorder>(new FlightRecorder());
+    if (!recorder->Open(desc)) return false;
+
+    m_pInstance = std::move(recorder);
+    m_pActive.store(m_pInstance.get(), std::memory_order_release);
+    m_nMinSeverity.store(desc.MinSeverity, std::memory_order_relaxed);
+    Logger::RefreshCallSiteGates();
+    return true;
+}
+
+void FlightRecorder::Terminate()
+{
+    m_nMinSeverity.store(FOX_LOG_LEVEL_OFF, std::memory_order_relaxed);
+    Logger::RefreshCallSiteGates();
+    m_pActive.store(nullptr, std::memory_order_release);
+    m_pInstance.reset();
+}
+
+void FlightRecorder::SetMinSeverity(const uint8_t severity)
+{
+    if (!IsActive()) return;
+    m_nMinSeverity.store(severity, std::memory_order_relaxed);
+    Logger::RefreshCallSiteGates();
+}
+
+FlightRecorder::~FlightRecorder()
+{
+    // unmapping does not truncate, whatever was recorded stays in the file
+    if (m_pView)                         UnmapViewOfFile(m_pView);
+    if (m_hMapping)                      CloseHandle(m_hMapping);
+    if (m_hFile != INVALID_HANDLE_VALUE) CloseHandle(m_hFile);
+}
+
+bool FlightRecorder::Open(const FLIGHT_RECORDER_DESC& desc)
+{
+    m_szFilePath = desc.FilePath;
+
+    const uint32_t slotCount  = std::bit_ceil(std::max<uint32_t>(desc.SlotCount, 64));
+    const uint32_t tableSize  = (std::max<uint32_t>(desc.FormatTableSize, 4096) + 4095) & ~4095u;
+    const uint32_t slotsStart = FlightLog::HEADER_REGION + tableSize;
+    m_nViewSize = static_cast<size_t>(slotsStart) + static_cast<size_t>(slotCount) * FlightLog::SLOT_SIZE;
+
+    if (const auto [DirectoryNames, FileName] = FileSystem::SplitPathFile(m_szFilePath); !DirectoryNames.empty())
+        FileSystem::CreateDirectories(DirectoryNames);
+
+    // keep the last run around, it is the one that crashed if nobody saved a snapshot
+    if (FileSystem::IsFile(m_szFilePath))
+    {
+        const std::string previous = m_szFilePath + ".prev";
+        FileSystem::DeleteFiles(previous);
+        FileSystem::MoveFiles(m_szFilePath, previous);
+    }
+
+    m_hFile = CreateFile(
+        m_szFilePath.c_str(),
+        GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ,
+        nullptr,
+        CREATE_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (m_hFile == INVALID_HANDLE_VALUE) return false;
+
+    const auto size64 = static_cast<uint64_t>(m_nViewSize);
+    m_hMapping = CreateFileMapping(
+        m_hFile,
+        nullptr,
+        PAGE_READWRITE,
+        static_cast<DWORD>(size64 >> 32),
+        static_cast<DWORD>(size64 & 0xFFFFFFFF),
+        nullptr);
+    if (!m_hMapping) return false;
+
+    m_pView = static_cast<char*>(MapViewOfFile(m_hMapping, FILE_MAP_WRITE, 0, 0, m_nViewSize));
+    if (!m_pView) return false;
+
+    // touch every page now so the first lap of the ring doesn't take the soft faults
+    for (size_t offset = 0; offset < m_nViewSize; offset += 4096)
+        static_cast<volatile char*>(m_pView)[offset] = 0;
+
+    m_pHeader   = reinterpret_cast<FlightLog::FLIGHT_FILE_HEADER*>(m_pView);
+    m_pSlots    = reinterpret_cast<FlightLog::FLIGHT_SLOT*>(m_pView + slotsStart);
+    m_nSlotMask = slotCount - 1;
+
+    FlightLog::FLIGHT_FILE_HEADER& header = *m_pHeader;
+    header.Version             = FlightLog::FILE_VERSION;
+    header.SlotSize            = FlightLog::SLOT_SIZE;
+    header.SlotCount           = slotCount;
+    header.FormatTableOffset   = FlightLog::HEADER_REGION;
+    header.FormatTableCapacity = tableSize;
+    header.SlotsOffset         = slotsStart;
+    header.ProcessId           = GetCurrentProcessId();
+    header.TickFrequency       = FastClock::GetFrequency();
+    header.StartTicks          = FastClock::Now();
+    header.StartUnixMicros     = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    // magic last, a half written header is never mistaken for a valid one
+    std::memcpy(header.Magic, FlightLog::FILE_MAGIC, sizeof(header.Magic));
+    return true;
+}
+
+uint32_t FlightRecorder::RegisterFormat(LOG_CALL_SITE& site, const LogLevel level, const std::string_view fmt)
+{
+    std::scoped_lock lock(m_formatMutex);
+
+    if (const uint32_t id = site.RecorderId.load(std::memory_order_acquire)) return id;
+
+    const std::string_view file = site.File ? site.File : "";
+    const auto fileLength   = static_cast<uint16_t>(std::min<size_t>(file.size(), UINT16_MAX));
+    const auto formatLength = static_cast<uint16_t>(std::min<size_t>(fmt.size(),  UINT16_MAX));
+    const size_t entrySize  = 1 + 4 + 2 + fileLength + 2 + formatLength;
+
+    FlightLog::FLIGHT_FILE_HEADER& header = *m_pHeader;
+    if (header.FormatTableUsed + entrySize > header.FormatTableCapacity)
+    {
+        site.RecorderId.store(FORMAT_TABLE_FULL, std::memory_order_release);
+        return FORMAT_TABLE_FULL;
+    }
+
+    BinLog::BINLOG_WRITER w{ m_pView + header.FormatTableOffset + header.FormatTableUsed, entrySize };
+    w.Put(static_cast<uint8_t>(level));
+    w.Put(site.Line);
+    w.Put(fileLength);
+    w.PutBytes(file.data(), fileLength);
+    w.Put(formatLength);
+    w.PutBytes(fmt.data(), formatLength);
+
+    header.FormatTableUsed += static_cast<uint32_t>(entrySize);
+    const uint32_t id = std::atomic_ref(header.FormatCount).fetch_add(1, std::memory_order_release) + 1;
+
+    site.RecorderId.store(id, std::memory_order_release);
+    return id;
+}
+
+FlightLog::FLIGHT_SLOT& FlightRecorder::BeginSlot(uint64_t& sequence)
+{
+    thread_local const uint32_t threadId = GetCurrentThreadId();
+
+    sequence = std::atomic_ref(m_pHeader->NextSequence).fetch_add(1, std::memory_order_relaxed);
+    FlightLog::FLIGHT_SLOT& slot = m_pSlots[sequence & m_nSlotMask];
+
+    // mark the slot torn until CommitSlot, a crash mid-write leaves it unreadable instead of wrong
+    std::atomic_ref(slot.Sequence).store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.Ticks    = FastClock::Now();
+    slot.ThreadId = threadId;
+    return slot;
+}
+
+void FlightRecorder::CommitSlot(FlightLog::FLIGHT_SLOT& slot, const uint64_t sequence)
+{
+    std::atomic_ref(slot.Sequence).store(sequence + 1, std::memory_order_release);
+}
+
+void FlightRecorder::Flush()
+{
+    if (!m_pInstance) return;
+    FlushViewOfFile(m_pInstance->m_pView, 0);
+    FlushFileBuffers(m_pInstance->m_hFile);
+}
+
+bool FlightRecorder::SaveSnapshot(const std::string& path)
+{
+    if (!m_pInstance) return false;
+
+    FileSystem fs{};
+    if (!fs.OpenForWrite(path)) return false;
+    fs.WriteBytes(m_pInstance->m_pView, m_pInstance->m_nViewSize);
+    fs.Close();
+    return true;
+}
+
+std::string FlightRecorder::GetFilePath()
+{
+    return m_pInstance ? m_pInstance->m_szFilePath : std::string{};
+}
@@ -0,0 +1,112 @@
+#ifndef FLIGHTRECORDER_H
+#define FLIGHTRECORDER_H
+
+#include "Common/Core.h"
+#include "Common/DefineWindows.h"
+#include "FlightRecorderFormat.h"
+#include "BinaryLog.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+typedef struct FLIGHT_RECORDER_DESC
+{
+    std::string FilePath        = "Logs\\FlightRecorder.fxfr"; // previous run is kept as <FilePath>.prev
+    uint32_t    SlotCount       = 16384;                       // rounded up to a power of two, 128 bytes each
+    uint32_t    FormatTableSize = 256 * 1024;
+    uint8_t     MinSeverity     = FOX_LOG_LEVEL_INFO;          // FOX_LOG_LEVEL_*, independent of the logger's category filters
+} FLIGHT_RECORDER_DESC;
+
+/**
+ * @brief Always-on crash history. Log calls land in a fixed-size memory-mapped ring file,
+ *        the OS still writes those pages back when the process dies. Read it with flight-reader.
+ */
+class FlightRecorder
+{
+public:
+    ~FlightRecorder();
+
+    static bool Initialize(const FLIGHT_RECORDER_DESC& desc);
+    //~ Only once no other thread can still be logging
+    static void Terminate();
+    static bool IsActive() { return m_pActive.load(std::memory_order_acquire) != nullptr; }
+
+    //~ One relaxed load, always false while no recorder is open. The LOG_* macros test Logger::ShouldSubmit, which folds this in.
+    static bool Wants(const LogLevel level)
+    {
+        return GetLevelSeverity(level) >= m_nMinSeverity.load(std::memory_order_relaxed);
+    }
+
+    //~ severity is one of FOX_LOG_LEVEL_*, ignored until Initialize
+    static void SetMinSeverity(uint8_t severity);
+    static uint8_t GetMinSeverity() { return m_nMinSeverity.load(std::memory_order_relaxed); }
+
+    //~ Hot path: one fetch_add and a few stores into the mapped slot, no locks, no syscalls
+    //~ the pack isn't called Args, that name is taken by FLIGHT_SLOT::Args below
+    template<typename... ArgTypes>
+    static void Record(LOG_CALL_SITE& site, const LogLevel level, const std::string_view fmt, const ArgTypes&... args)
+    {
+        if (!Wants(level)) return;
+
+        FlightRecorder* recorder = m_pActive.load(std::memory_order_acquire);
+        if (!recorder) return;
+
+        uint32_t id = site.RecorderId.load(std::memory_order_acquire);
+        if (id == 0) id = recorder->RegisterFormat(site, level, fmt);
+        if (id == FORMAT_TABLE_FULL) return;
+
+        uint64_t sequence = 0;
+        FlightLog::FLIGHT_SLOT& slot = recorder->BeginSlot(sequence);
+
+        BinLog::BINLOG_WRITER w{ slot.Args, sizeof(slot.Args) };
+        (BinLog::EncodeArg(w, args), ...);
+
+        slot.FormatId = id;
+        slot.Level    = static_cast<uint8_t>(level);
+        slot.ArgSize  = static_cast<uint8_t>(w.Size);
+        CommitSlot(slot, sequence);
+    }
+
+    //~ Pages survive a process crash on their own, this also covers a machine going down
+    static void Flush();
+
+    //~ Copies the ring out (crash reports), the live file is reused by the next run
+    static bool SaveSnapshot(const std::string& path);
+
+    _fox_Return_enforce static std::string GetFilePath();
+
+private:
+    //~ Cached in LOG_CALL_SITE::RecorderId once the table had no room, the site stops asking
+    static constexpr uint32_t FORMAT_TABLE_FULL = UINT32_MAX;
+
+    FlightRecorder() = default;
+
+    bool Open(const FLIGHT_RECORDER_DESC& desc);
+    uint32_t RegisterFormat(LOG_CALL_SITE& site, LogLevel level, std::string_view fmt);
+    FlightLog::FLIGHT_SLOT& BeginSlot(uint64_t& sequence);
+    static void CommitSlot(FlightLog::FLIGHT_SLOT& slot, uint64_t sequence);
+
+private:
+    inline static std::atomic<FlightRecorder*> m_pActive{ nullptr };
+    inline static std::atomic<uint8_t>         m_nMinSeverity{ FOX_LOG_LEVEL_OFF };
+    static std::unique_ptr<FlightRecorder> m_pInstance;
+
+    HANDLE      m_hFile   { INVALID_HANDLE_VALUE };
+    HANDLE      m_hMapping{ nullptr };
+    char*       m_pView   { nullptr };
+    size_t      m_nViewSize{ 0 };
+    std::string m_szFilePath;
+
+    FlightLog::FLIGHT_FILE_HEADER* m_pHeader  { nullptr };
+    FlightLog::FLIGHT_SLOT*        m_pSlots   { nullptr };
+    uint64_t                       m_nSlotMask{ 0 };
+    std::mutex                     m_formatMutex;
+};
+
+#define INIT_FLIGHT_RECORDER(desc) FlightRecorder::Initialize(desc)
+#define FLUSH_FLIGHT_RECORDER()    FlightRecorder::Flush()
+
+#endif //FLIGHTRECORDER_H
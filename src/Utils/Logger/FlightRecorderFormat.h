@@ -0,0 +1,60 @@
+#ifndef FLIGHTRECORDERFORMAT_H
+#define FLIGHTRECORDERFORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * .fxfr layout (little endian, fixed size, memory mapped by the writer):
+ *  [0, HEADER_REGION)                    FLIGHT_FILE_HEADER
+ *  [FormatTableOffset, +Capacity)        format table, FormatCount entries, id = index + 1
+ *                                        entry: uint8 Level, uint32 Line, uint16 FileLen, file,
+ *                                               uint16 FormatLen, format
+ *  [SlotsOffset, +SlotCount * SLOT_SIZE) ring of FLIGHT_SLOT, slot = sequence & (SlotCount - 1)
+ *
+ *  Slot args use the BinLog type-tagged encoding, so BinaryLogDecoder::FormatRecord replays them.
+ */
+namespace FlightLog
+{
+    inline constexpr char     FILE_MAGIC[4]{ 'F', 'X', 'F', 'R' };
+    inline constexpr uint16_t FILE_VERSION { 1 };
+    inline constexpr uint32_t HEADER_REGION{ 4096 };
+    inline constexpr uint32_t SLOT_SIZE    { 128 };
+
+    typedef struct FLIGHT_FILE_HEADER
+    {
+        char     Magic[4];
+        uint16_t Version;
+        uint16_t SlotSize;
+        uint32_t SlotCount;           // power of two
+        uint32_t FormatTableOffset;
+        uint32_t FormatTableCapacity;
+        uint32_t SlotsOffset;
+        uint32_t ProcessId;
+        uint32_t Reserved;
+        uint64_t TickFrequency;       // ticks per second
+        uint64_t StartTicks;          // tick value at StartUnixMicros
+        int64_t  StartUnixMicros;
+        uint64_t NextSequence;        // writers fetch_add this through std::atomic_ref
+        uint32_t FormatTableUsed;     // bytes
+        uint32_t FormatCount;         // published after the entry bytes
+    } FLIGHT_FILE_HEADER;
+
+    typedef struct FLIGHT_SLOT
+    {
+        uint64_t Sequence;  // sequence + 1 once complete, 0 while a writer is inside
+        uint64_t Ticks;
+        uint32_t ThreadId;
+        uint32_t FormatId;
+        uint8_t  Level;
+        uint8_t  ArgSize;
+        uint8_t  Reserved[2];
+        char     Args[SLOT_SIZE - 28];
+    } FLIGHT_SLOT;
+
+    static_assert(sizeof(FLIGHT_FILE_HEADER) <= HEADER_REGION);
+    static_assert(sizeof(FLIGHT_SLOT) == SLOT_SIZE);
+    static_assert(offsetof(FLIGHT_FILE_HEADER, NextSequence) % 8 == 0);
+}
+
+#endif //FLIGHTRECORDERFORMAT_H
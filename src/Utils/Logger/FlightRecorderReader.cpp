@@ -0,0 +1,139 @@
+#include "FlightRecorderReader.h"
+#include "BinaryLogDecoder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <format>
+
+bool FlightRecorderReader::Read(const std::string_view bytes, std::string& out)
+{
+    if (!ReadHeader(bytes) || !ReadFormatTable(bytes)) return false;
+
+    // a slot is trusted only if it is complete and its sequence maps back onto it
+    std::vector<FlightLog::FLIGHT_SLOT> slots;
+    const uint64_t mask = m_header.SlotCount - 1;
+    for (uint32_t i = 0; i < m_header.SlotCount; ++i)
+    {
+        FlightLog::FLIGHT_SLOT slot{};
+        std::memcpy(&slot, bytes.data() + m_header.SlotsOffset + static_cast<size_t>(i) * FlightLog::SLOT_SIZE, sizeof(slot));
+        if (slot.Sequence == 0 || ((slot.Sequence - 1) & mask) != i) continue;
+        if (slot.ArgSize > sizeof(slot.Args)) continue;
+        slots.push_back(slot);
+    }
+
+    std::ranges::sort(slots, {}, &FlightLog::FLIGHT_SLOT::Sequence);
+
+    const auto startTime = std::chrono::sys_time<std::chrono::microseconds>(
+        std::chrono::microseconds(m_header.StartUnixMicros));
+    std::format_to(std::back_inserter(out), "Flight recorder: pid {}, started {:%Y-%m-%d %H:%M:%S} UTC, {} record(s) in ring\n",
+                   m_header.ProcessId, std::chrono::floor<std::chrono::seconds>(startTime), slots.size());
+    if (slots.empty()) return true;
+
+    // the newest record defines "now" for the --seconds window
+    uint64_t cutoff = 0;
+    if (m_desc.LastSeconds > 0.0 && m_header.TickFrequency)
+    {
+        const uint64_t newest = std::ranges::max(slots, {}, &FlightLog::FLIGHT_SLOT::Ticks).Ticks;
+        const auto     window = static_cast<uint64_t>(m_desc.LastSeconds * static_cast<double>(m_header.TickFrequency));
+        cutoff = newest > window ? newest - window : 0;
+    }
+
+    const double frequency = m_header.TickFrequency ? static_cast<double>(m_header.TickFrequency) : 1.0;
+    uint64_t expected = 0;
+    for (const FlightLog::FLIGHT_SLOT& slot : slots)
+    {
+        if (slot.Ticks < cutoff) continue;
+
+        if (expected != 0 && slot.Sequence != expected)
+            std::format_to(std::back_inserter(out), "... {} record(s) missing (torn or overwritten)\n", slot.Sequence - expected);
+        expected = slot.Sequence + 1;
+
+        const double seconds = static_cast<double>(static_cast<int64_t>(slot.Ticks - m_header.StartTicks)) / frequency;
+        std::format_to(std::back_inserter(out), "[+{:.6f}] ", seconds);
+        if (m_desc.ShowThreadIds) std::format_to(std::back_inserter(out), "[T{}] ", slot.ThreadId);
+
+        if (slot.FormatId == 0 || slot.FormatId > m_formats.size())
+        {
+            std::format_to(std::back_inserter(out), "{}<unknown format {}>\n", GetLevelPrefix(LogLevel::Print), slot.FormatId);
+            continue;
+        }
+
+        const FORMAT_DEF& def = m_formats[slot.FormatId - 1];
+        out.append(GetLevelPrefix(static_cast<LogLevel>(slot.Level)));
+        out.append(BinaryLogDecoder::FormatRecord(def.Format, { slot.Args, slot.ArgSize }));
+        if (m_desc.ShowCallSites) std::format_to(std::back_inserter(out), "  ({}:{})", def.File, def.Line);
+        out += '\n';
+    }
+    return true;
+}
+
+bool FlightRecorderReader::ReadHeader(const std::string_view bytes)
+{
+    if (bytes.size() < FlightLog::HEADER_REGION)
+    {
+        m_szError = "File is smaller than the flight recorder header";
+        return false;
+    }
+
+    std::memcpy(&m_header, bytes.data(), sizeof(m_header));
+    if (std::memcmp(m_header.Magic, FlightLog::FILE_MAGIC, sizeof(m_header.Magic)) != 0)
+    {
+        m_szError = "Not a flight recorder file (bad magic)";
+        return false;
+    }
+    if (m_header.Version != FlightLog::FILE_VERSION || m_header.SlotSize != FlightLog::SLOT_SIZE)
+    {
+        m_szError = std::format("Unsupported flight recorder version {} (slot size {})", m_header.Version, m_header.SlotSize);
+        return false;
+    }
+
+    const uint64_t tableEnd = static_cast<uint64_t>(m_header.FormatTableOffset) + m_header.FormatTableCapacity;
+    const uint64_t slotsEnd = static_cast<uint64_t>(m_header.SlotsOffset) + static_cast<uint64_t>(m_header.SlotCount) * FlightLog::SLOT_SIZE;
+    if (m_header.SlotCount == 0 || (m_header.SlotCount & (m_header.SlotCount - 1)) != 0 ||
+        tableEnd > bytes.size() || slotsEnd > bytes.size() || m_header.FormatTableUsed > m_header.FormatTableCapacity)
+    {
+        m_szError = "Flight recorder header does not match the file size";
+        return false;
+    }
+    return true;
+}
+
+bool FlightRecorderReader::ReadFormatTable(const std::string_view bytes)
+{
+    const std::string_view table = bytes.substr(m_header.FormatTableOffset, m_header.FormatTableUsed);
+
+    size_t offset = 0;
+    auto take = [&](void* dest, const size_t n)
+    {
+        if (offset + n > table.size()) return false;
+        std::memcpy(dest, table.data() + offset, n);
+        offset += n;
+        return true;
+    };
+    auto takeString = [&](std::string_view& dest)
+    {
+        uint16_t length = 0;
+        if (!take(&length, sizeof(length)) || offset + length > table.size()) return false;
+        dest = table.substr(offset, length);
+        offset += length;
+        return true;
+    };
+
+    m_formats.reserve(m_header.FormatCount);
+    for (uint32_t i = 0; i < m_header.FormatCount; ++i)
+    {
+        uint8_t    level = 0;
+        FORMAT_DEF def{};
+        if (!take(&level, sizeof(level)) || !take(&def.Line, sizeof(def.Line)) ||
+            !takeString(def.File) || !takeString(def.Format))
+        {
+            // a crash during registration only costs the entries after it
+            m_szError = std::format("Format table cut short after {} entries", i);
+            break;
+        }
+        def.Level = static_cast<LogLevel>(level);
+        m_formats.push_back(def);
+    }
+    return true;
+}
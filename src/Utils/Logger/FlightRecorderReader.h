@@ -0,0 +1,52 @@
+#ifndef FLIGHTRECORDERREADER_H
+#define FLIGHTRECORDERREADER_H
+
+#include "Common/Core.h"
+#include "FlightRecorderFormat.h"
+#include "LogTypes.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+typedef struct FLIGHT_READ_DESC
+{
+    double LastSeconds   = 0.0;  // 0 keeps everything still in the ring
+    bool   ShowThreadIds = true;
+    bool   ShowCallSites = false; // "(file:line)" after each line
+} FLIGHT_READ_DESC;
+
+/**
+ * @brief Rebuilds the recorded history from a .fxfr ring, oldest first.
+ *        Platform independent so it can run inside the offline tools.
+ */
+class FlightRecorderReader
+{
+public:
+    explicit FlightRecorderReader(const FLIGHT_READ_DESC& desc = {}) : m_desc(desc) {}
+
+    //~ Appends the decoded text to out, false if the file is not a usable ring
+    bool Read(std::string_view bytes, std::string& out);
+
+    _fox_Return_enforce const std::string& GetError() const { return m_szError; }
+
+private:
+    struct FORMAT_DEF
+    {
+        LogLevel         Level{ LogLevel::Print };
+        uint32_t         Line { 0 };
+        std::string_view File;
+        std::string_view Format;
+    };
+
+    bool ReadHeader     (std::string_view bytes);
+    bool ReadFormatTable(std::string_view bytes);
+
+private:
+    FLIGHT_READ_DESC              m_desc;
+    FlightLog::FLIGHT_FILE_HEADER m_header{};
+    std::vector<FORMAT_DEF>       m_formats;
+    std::string                   m_szError;
+};
+
+#endif //FLIGHTRECORDERREADER_H
@@ -0,0 +1,107 @@
+#include "LogQueue.h"
+
+#include <bit>
+#include <cstring>
+#include <thread>
+
+LogQueue::LogQueue(size_t capacity)
+{
+    capacity = std::bit_ceil(capacity < 2 ? size_t{ 2 } : capacity);
+
+    m_pCells = std::make_unique<Cell[]>(capacity);
+    m_nMask  = capacity - 1;
+
+    for (size_t i = 0; i < capacity; ++i)
+        m_pCells[i].Sequence.store(i, std::memory_order_relaxed);
+}
+
+bool LogQueue::Push(const LogLevel level, const std::string_view text, const LogOverflowPolicy policy)
+{
+    if (TryPush(level, text)) return true;
+
+    switch (policy)
+    {
+    case LogOverflowPolicy::Block:
+        while (!TryPush(level, text)) std::this_thread::yield();
+        return true;
+
+    case LogOverflowPolicy::DropNewest:
+        m_nDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+
+    case LogOverflowPolicy::DropOldest:
+        do
+        {
+            // evicting may race with the writer, only count what we actually threw away
+            if (TryEvict()) m_nDropped.fetch_add(1, std::memory_order_relaxed);
+            else std::this_thread::yield(); // a pinned head only leaves through the writer
+        } while (!TryPush(level, text));
+        return true;
+    }
+    return false;
+}
+
+void LogQueue::PushPinned(const LogLevel level, const std::string_view text)
+{
+    while (!TryPush(level, text, true)) std::this_thread::yield();
+}
+
+bool LogQueue::TryEvict()
+{
+    size_t pos = m_nDequeuePos.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        Cell& cell = m_pCells[pos & m_nMask];
+        const size_t seq = cell.Sequence.load(std::memory_order_acquire);
+        const auto diff  = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+        if (diff == 0)
+        {
+            // if the CAS below succeeds nobody consumed the slot in between, so the flag read here was this record's
+            if (cell.Pinned.load(std::memory_order_relaxed)) return false;
+            if (m_nDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.Sequence.store(pos + m_nMask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0) return false; // empty
+        else pos = m_nDequeuePos.load(std::memory_order_relaxed);
+    }
+}
+
+bool LogQueue::TryPush(const LogLevel level, const std::string_view text, const bool pinned)
+{
+    Cell* cell = nullptr;
+    size_t pos = m_nEnqueuePos.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        cell = &m_pCells[pos & m_nMask];
+        const size_t seq = cell->Sequence.load(std::memory_order_acquire);
+        const auto diff  = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+        if (diff == 0)
+        {
+            if (m_nEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if (diff < 0) return false; // full
+        else pos = m_nEnqueuePos.load(std::memory_order_relaxed);
+    }
+
+    LOG_RECORD& record = cell->Record;
+    const size_t length = text.size() < LOG_RECORD_CAPACITY ? text.size() : LOG_RECORD_CAPACITY;
+    std::memcpy(record.Text, text.data(), length);
+
+    // keep truncated lines terminated so the sink doesn't glue them together
+    if (length == LOG_RECORD_CAPACITY && text.size() > LOG_RECORD_CAPACITY)
+        record.Text[length - 1] = '\n';
+
+    record.Level  = level;
+    record.Length = static_cast<uint32_t>(length);
+    cell->Pinned.store(pinned, std::memory_order_relaxed);
+
+    cell->Sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
@@ -0,0 +1,96 @@
+#ifndef LOGQUEUE_H
+#define LOGQUEUE_H
+
+#include "Common/Core.h"
+#include "LogTypes.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+inline constexpr size_t LOG_RECORD_CAPACITY = 2048;
+
+typedef struct LOG_RECORD
+{
+    LogLevel Level{ LogLevel::Print };
+    uint32_t Length{ 0 };
+    char     Text[LOG_RECORD_CAPACITY];
+
+    std::string_view View() const { return { Text, Length }; }
+} LOG_RECORD;
+
+/**
+ * @brief Bounded multi-producer / multi-consumer ring of fully formatted log records.
+ *        Per-slot sequence numbers (Vyukov style) keep both ends lock-free.
+ */
+class LogQueue
+{
+public:
+    explicit LogQueue(size_t capacity);
+    ~LogQueue() = default;
+
+    LogQueue(const LogQueue&)            = delete;
+    LogQueue& operator=(const LogQueue&) = delete;
+
+    //~ Applies the overflow policy, returns false if the record was discarded
+    bool Push(LogLevel level, std::string_view text, LogOverflowPolicy policy);
+
+    //~ Waits for room instead of dropping, and DropOldest never evicts the record (stream structure the reader can't lose)
+    void PushPinned(LogLevel level, std::string_view text);
+
+    bool TryPush(LogLevel level, std::string_view text, bool pinned = false);
+
+    //~ Hands the oldest record to fn in place, then releases the slot
+    template<typename Fn>
+    bool TryConsume(Fn&& fn);
+
+    _fox_Return_enforce size_t   Capacity    () const { return m_nMask + 1; }
+    _fox_Return_enforce uint64_t DroppedCount() const { return m_nDropped.load(std::memory_order_relaxed); }
+
+private:
+    //~ Discards the oldest record unless it is pinned, returns false if nothing was thrown away
+    bool TryEvict();
+
+private:
+    struct alignas(64) Cell
+    {
+        std::atomic<size_t> Sequence{ 0 };
+        std::atomic<bool>   Pinned  { false }; // atomic, evicting producers peek at it before claiming the slot
+        LOG_RECORD          Record{};
+    };
+
+    std::unique_ptr<Cell[]> m_pCells;
+    size_t                  m_nMask{ 0 };
+
+    alignas(64) std::atomic<size_t>   m_nEnqueuePos{ 0 };
+    alignas(64) std::atomic<size_t>   m_nDequeuePos{ 0 };
+    alignas(64) std::atomic<uint64_t> m_nDropped   { 0 };
+};
+
+template<typename Fn>
+bool LogQueue::TryConsume(Fn&& fn)
+{
+    Cell* cell = nullptr;
+    size_t pos = m_nDequeuePos.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        cell = &m_pCells[pos & m_nMask];
+        const size_t seq = cell->Sequence.load(std::memory_order_acquire);
+        const auto diff  = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+        if (diff == 0)
+        {
+            if (m_nDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if (diff < 0) return false; // empty
+        else pos = m_nDequeuePos.load(std::memory_order_relaxed);
+    }
+
+    fn(cell->Record);
+    cell->Sequence.store(pos + m_nMask + 1, std::memory_order_release);
+    return true;
+}
+
+#endif //LOGQUEUE_H
@@ -0,0 +1,101 @@
+#ifndef LOGTYPES_H
+#define LOGTYPES_H
+
+#include <cstdint>
+#include <string_view>
+#include <iterator>
+
+enum class IndentStyle : uint8_t { Unicode, ASCII };
+
+enum class LogLevel: uint8_t
+{
+    Info,
+    Warning,
+    Error,
+    Success,
+    Fail,
+    Print
+};
+
+//~ Severity ranks used for filtering, LogLevel itself is only a display tag
+#define FOX_LOG_LEVEL_VERBOSE 0 // LOG_PRINT
+#define FOX_LOG_LEVEL_INFO    1 // LOG_INFO, LOG_SUCCESS
+#define FOX_LOG_LEVEL_WARNING 2 // LOG_WARNING
+#define FOX_LOG_LEVEL_ERROR   3 // LOG_ERROR, LOG_FAIL
+#define FOX_LOG_LEVEL_OFF     4
+
+//~ Anything below this is compiled out, arguments included (set from CMake)
+#ifndef FOX_LOG_MIN_LEVEL
+    #define FOX_LOG_MIN_LEVEL FOX_LOG_LEVEL_VERBOSE
+#endif
+
+constexpr uint8_t GetLevelSeverity(const LogLevel level)
+{
+    switch (level)
+    {
+    case LogLevel::Print:   return FOX_LOG_LEVEL_VERBOSE;
+    case LogLevel::Info:
+    case LogLevel::Success: return FOX_LOG_LEVEL_INFO;
+    case LogLevel::Warning: return FOX_LOG_LEVEL_WARNING;
+    case LogLevel::Error:
+    case LogLevel::Fail:    return FOX_LOG_LEVEL_ERROR;
+    }
+    return FOX_LOG_LEVEL_ERROR;
+}
+
+//~ False for levels FOX_LOG_MIN_LEVEL strips, work guarded by LOG_ENABLED folds away with them
+template<LogLevel level>
+inline constexpr bool LOG_LEVEL_COMPILED_IN = GetLevelSeverity(level) >= FOX_LOG_MIN_LEVEL;
+
+//~ Runtime filter channels, each one has its own threshold
+enum class LogCategory: uint8_t
+{
+    General,
+    Render,
+    Window,
+    Input,
+    Vulkan,
+    Count
+};
+
+//~ What an async producer does when the ring buffer is full
+enum class LogOverflowPolicy: uint8_t
+{
+    Block,      // spin until the writer thread frees a slot
+    DropNewest, // discard the record being pushed
+    DropOldest  // evict the oldest queued record to make room
+};
+
+//~ Shared by the live logger and the offline decoders so both print the same tree
+typedef struct LOG_INDENT_GLYPHS
+{
+    std::string_view V;
+    std::string_view T;
+    std::string_view L;
+    std::string_view SP;
+} LOG_INDENT_GLYPHS;
+
+inline constexpr LOG_INDENT_GLYPHS LOG_UNICODE_GLYPHS{ "│   ", "├── ", "└── ", "    " };
+inline constexpr LOG_INDENT_GLYPHS LOG_ASCII_GLYPHS  { "|   ", "|-- ", "`-- ", "    " };
+
+inline const LOG_INDENT_GLYPHS& GetIndentGlyphs(const IndentStyle style)
+{
+    return style == IndentStyle::Unicode ? LOG_UNICODE_GLYPHS : LOG_ASCII_GLYPHS;
+}
+
+inline std::string_view GetLevelPrefix(const LogLevel level)
+{
+    static constexpr std::string_view prefixes[]
+    {
+        "[INFO]    ", // Info
+        "[WARNING] ", // Warning
+        "[ERROR]   ", // Error
+        "[SUCCESS] ", // Success
+        "[FAIL]    ", // Fail
+        "          "  // Print
+    };
+    const auto index = static_cast<uint8_t>(level);
+    return index < std::size(prefixes) ? prefixes[index] : prefixes[std::size(prefixes) - 1];
+}
+
+#endif //LOGTYPES_H
@@ -6,6 +6,7 @@
 
 #include <sstream>
 #include <iomanip>
+#include <chrono>
 
 std::unique_ptr<Logger> Logger::m_pInstance = nullptr;
 
@@ -14,12 +15,27 @@ void Logger::Initialize(const LOGGER_INIT_DESC &desc)
     if (!m_pInstance)
     {
         m_pInstance = std::unique_ptr<Logger>(new Logger(desc));
+        RefreshCallSiteGates();
     }
 }
 
 void Logger::Terminate()
 {
     m_pInstance.reset();
+    RefreshCallSiteGates();
+}
+
+void Logger::RefreshCallSiteGates()
+{
+    std::scoped_lock lock(m_gateMutex);
+
+    // folding both thresholds here keeps the macro guard at a single load
+    const uint8_t recorder = FlightRecorder::GetMinSeverity();
+    for (uint8_t category = 0; category < static_cast<uint8_t>(LogCategory::Count); ++category)
+    {
+        const uint8_t sinks = IsInitialized() ? m_categoryThresholds[category].load(std::memory_order_relaxed) : FOX_LOG_LEVEL_OFF;
+        m_callSiteGates[category].Threshold.store(std::min(sinks, recorder), std::memory_order_relaxed);
+    }
 }
 
 Logger& Logger::Get()
@@ -30,7 +46,8 @@ Logger& Logger::Get()
 }
 
 Logger::Logger(const LOGGER_INIT_DESC& desc)
-    : m_bTerminalEnabled(desc.EnableTerminal)
+    : m_bTerminalEnabled(desc.EnableTerminal),
+      m_bBinary(desc.EnableBinary)
 {
     if (desc.EnableTerminal)
     {
@@ -40,57 +57,225 @@ Logger::Logger(const LOGGER_INIT_DESC& desc)
     // Create log directory if it doesn't exist
     FileSystem::CreateDirectories(desc.FolderPath);
 
-    const std::string logFilePath = std::format("{}\\{}_{}.log",
+    const std::string logFilePath = std::format("{}\\{}_{}.{}",
                                           desc.FolderPath,
                                           desc.FilePrefix,
-                                          GetTimestamp());
+                                          GetTimestamp(),
+                                          m_bBinary ? "binlog" : "log");
 
     // Open custom FileSystem log file for writing
     m_logFile.OpenForWrite(logFilePath);
+    if (m_bBinary) WriteBinaryHeader();
+
+    // binary records are only cheap if the caller never touches the file
+    if (desc.EnableAsync || m_bBinary)
+    {
+        m_overflowPolicy = desc.OverflowPolicy;
+        m_pQueue         = std::make_unique<LogQueue>(desc.QueueCapacity);
+        m_fileBatch.reserve(64 * 1024);
+        m_writerThread   = std::jthread([this](const std::stop_token& token) { WriterLoop(token); });
+    }
 }
 
 Logger::~Logger()
 {
+    if (m_writerThread.joinable())
+    {
+        m_writerThread.request_stop();
+        m_nPendingSignal.fetch_add(1);
+        m_nPendingSignal.notify_one();
+        m_writerThread.join();
+    }
+    DrainQueue();
     m_logFile.Close();
 }
 
-void Logger::Log(const LogLevel level, const std::string &msg)
+void Logger::Flush()
 {
-    std::scoped_lock lock(m_mutex);
+    if (!IsInitialized()) return;
+    Logger& logger = Get();
 
-    std::string levelPrefix;
-    switch (level)
+    if (logger.m_pQueue)
     {
-    case LogLevel::Info:    levelPrefix = "[INFO]    "; break;
-    case LogLevel::Warning: levelPrefix = "[WARNING] "; break;
-    case LogLevel::Error:   levelPrefix = "[ERROR]   "; break;
-    case LogLevel::Success: levelPrefix = "[SUCCESS] "; break;
-    case LogLevel::Fail:    levelPrefix = "[FAIL]    "; break;
-    case LogLevel::Print:   levelPrefix = "          "; break;
+        // drain on the caller, the writer thread may already be gone on a crash path
+        logger.DrainQueue();
+        logger.m_logFile.Flush();
+        return;
     }
 
-    // Tree-style prefix (for regular lines inside current scope)
-    const std::string treePrefix = BuildPrefix(/*isNodeLine=*/false);
+    std::scoped_lock lock(logger.m_mutex);
+    logger.m_logFile.Flush();
+}
+
+uint64_t Logger::GetDroppedCount()
+{
+    if (!IsInitialized() || !Get().m_pQueue) return 0;
+    return Get().m_pQueue->DroppedCount();
+}
+
+LOG_LINE_BUFFER& Logger::ThreadLineBuffer()
+{
+    thread_local LOG_LINE_BUFFER line{};
+    return line;
+}
+
+LOG_SCOPE_STACK& Logger::ThreadScopes()
+{
+    thread_local LOG_SCOPE_STACK scopes = []
+    {
+        LOG_SCOPE_STACK stack{};
+        stack.Prefix.reserve(256);
+        stack.Frames.reserve(16);
+        return stack;
+    }();
+    return scopes;
+}
+
+void Logger::BeginLine(LOG_LINE_BUFFER& line, const LogLevel level) const
+{
+    line.Size = 0;
 
-    // If you still want legacy tab support for places where you used LOG_ADD_TAB/REMOVE_TAB,
-    // you can append tabs AFTER the tree prefix (or remove m_nTabs usage entirely).
-    std::string tabPrefix(m_nTabs, '\t');
+    // Tree-style prefix (for regular lines inside current scope), cached when the scope opened
+    const LOG_SCOPE_STACK& scopes = ThreadScopes();
+    line.Append(scopes.Prefix);
 
-    const std::string fullMsg = std::format("{}{}{}{}\n", treePrefix, tabPrefix, levelPrefix, msg);
+    // legacy LOG_ADD_TAB/REMOVE_TAB support goes after the tree prefix
+    line.Append('\t', scopes.Tabs);
+    line.Append(LevelPrefix(level));
+}
+
+void Logger::CommitLine(const LogLevel level, LOG_LINE_BUFFER& line)
+{
+    line.Data[line.Size++] = '\n';
+
+    if (m_pQueue)
+    {
+        PushRecord(level, line.View());
+        return;
+    }
 
     // Print to terminal
     if (m_bTerminalEnabled && m_hConsole)
     {
         SetConsoleColor(level);
         DWORD written;
-        WriteConsoleA(m_hConsole, fullMsg.c_str(), static_cast<DWORD>(fullMsg.length()), &written, nullptr);
+        WriteConsoleA(m_hConsole, line.Data, static_cast<DWORD>(line.Size), &written, nullptr);
         SetConsoleTextAttribute(m_hConsole, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
     }
 
     // Write to log file
     if (m_logFile.IsOpen())
     {
-        m_logFile.WritePlainText(fullMsg);
+        m_logFile.WriteBytes(line.Data, line.Size);
+    }
+}
+
+std::string_view Logger::LevelPrefix(const LogLevel level)
+{
+    return GetLevelPrefix(level);
+}
+
+void Logger::PushRecord(const LogLevel level, const std::string_view bytes)
+{
+    if (!m_pQueue->Push(level, bytes, m_overflowPolicy)) return;
+
+    // only pay for the wake-up when the writer actually sleeps (seq_cst pairs with WriterLoop)
+    m_nPendingSignal.fetch_add(1);
+    if (m_bWriterParked.load()) m_nPendingSignal.notify_one();
+}
+
+void Logger::PushStructure(const std::string_view bytes)
+{
+    // scope and tab records are never dropped, losing one unbalances that thread's tree for the rest of the file
+    m_pQueue->PushPinned(LogLevel::Print, bytes);
+
+    m_nPendingSignal.fetch_add(1);
+    if (m_bWriterParked.load()) m_nPendingSignal.notify_one();
+}
+
+void Logger::WriterLoop(const std::stop_token& stopToken)
+{
+    while (!stopToken.stop_requested())
+    {
+        // drain with the flag down, producers pushing meanwhile skip the wake-up syscall
+        if (DrainQueue()) continue;
+
+        m_bWriterParked.store(true);
+        const uint64_t seen = m_nPendingSignal.load();
+        // the destructor bumps the signal after request_stop, if 'seen' holds that bump no wake-up follows.
+        // A push that read the flag before it went up bumped the signal before 'seen', this drain catches it
+        if (!stopToken.stop_requested() && !DrainQueue())
+        {
+            // any push after 'seen' changes the signal, so wait() can't miss it
+            m_nPendingSignal.wait(seen);
+        }
+        m_bWriterParked.store(false);
+    }
+}
+
+bool Logger::DrainQueue()
+{
+    if (!m_pQueue) return false;
+
+    std::scoped_lock lock(m_sinkMutex);
+
+    bool drained = false;
+    while (m_pQueue->TryConsume([this](const LOG_RECORD& record)
+    {
+        if (m_bCallSitesPending.load(std::memory_order_acquire)) WritePendingCallSites();
+        WriteToSinks(record.Level, record.View());
+    }))
+    {
+        drained = true;
+    }
+    if (m_bCallSitesPending.load(std::memory_order_acquire)) WritePendingCallSites();
+
+    if (const uint64_t dropped = m_pQueue->DroppedCount(); dropped != m_nReportedDrops)
+    {
+        const std::string note = std::format("{} log record(s) dropped (queue full)", dropped - m_nReportedDrops);
+        m_nReportedDrops = dropped;
+
+        if (m_bBinary)
+        {
+            char buffer[LOG_RECORD_CAPACITY];
+            BinLog::BINLOG_WRITER w{ buffer, sizeof(buffer) };
+            w.BeginRecord(BinLog::RecordKind::Text);
+            w.Put(ReadTicks());
+            w.Put(ThreadId());
+            w.Put(static_cast<uint8_t>(LogLevel::Warning));
+            w.PutString(note);
+            WriteToSinks(LogLevel::Warning, w.EndRecord());
+        }
+        else
+        {
+            WriteToSinks(LogLevel::Warning, std::format("{}{}\n", LevelPrefix(LogLevel::Warning), note));
+        }
+    }
+
+    if (!m_fileBatch.empty() && m_logFile.IsOpen())
+    {
+        m_logFile.WriteBytes(m_fileBatch.data(), m_fileBatch.size());
+        m_fileBatch.clear();
+    }
+    return drained;
+}
+
+void Logger::WriteToSinks(const LogLevel level, const std::string_view text)
+{
+    if (m_bTerminalEnabled && m_hConsole && !m_bBinary)
+    {
+        SetConsoleColor(level);
+        DWORD written;
+        WriteConsoleA(m_hConsole, text.data(), static_cast<DWORD>(text.length()), &written, nullptr);
+        SetConsoleTextAttribute(m_hConsole, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
+    }
+
+    // one WriteFile per batch instead of per line
+    m_fileBatch.append(text);
+    if (m_fileBatch.size() >= 60 * 1024 && m_logFile.IsOpen())
+    {
+        m_logFile.WriteBytes(m_fileBatch.data(), m_fileBatch.size());
+        m_fileBatch.clear();
     }
 }
 
@@ -150,47 +335,155 @@ void Logger::EnableTerminal()
 }
 
 
-void Logger::BeginScopeImpl(const std::string& name, bool hasNextSibling)
+void Logger::BeginScopeImpl(const std::string_view name, const bool hasNextSibling)
 {
-    const std::string nodePrefix = BuildPrefix(true);
-    Log(LogLevel::Print, nodePrefix + name);
+    LOG_LINE_BUFFER& line   = ThreadLineBuffer();
+    LOG_SCOPE_STACK& scopes = ThreadScopes();
+    if (m_bBinary)
+    {
+        BinLog::BINLOG_WRITER w{ line.Data, LOG_RECORD_CAPACITY };
+        w.BeginRecord(BinLog::RecordKind::ScopeBegin);
+        w.Put(ReadTicks());
+        w.Put(ThreadId());
+        w.Put(static_cast<uint8_t>(hasNextSibling ? 1 : 0));
+        w.PutString(name);
+        PushStructure(w.EndRecord());
+    }
+    else
+    {
+        std::unique_lock lock(m_mutex, std::defer_lock);
+        if (!m_pQueue) lock.lock();
+
+        BeginLine(line, LogLevel::Print);
+        AppendNodePrefix(line, scopes);
+        line.Append(name);
+        CommitLine(LogLevel::Print, line);
+    }
 
-    // Descend one level; remember fox whether THIS level still has siblings
-    m_scopeHasNext.push_back(hasNextSibling);
+    // Descend one level; remember whether THIS level still has siblings and extend the cached guide
+    const LOG_INDENT_GLYPHS& g = GetIndentGlyphs(m_indentStyle);
+    scopes.Frames.push_back({ scopes.Prefix.size(), hasNextSibling });
+    scopes.Prefix.append(hasNextSibling ? g.V : g.SP);
 }
 
 void Logger::EndScopeImpl()
 {
-    if (!m_scopeHasNext.empty())
-        m_scopeHasNext.pop_back();
+    LOG_SCOPE_STACK& scopes = ThreadScopes();
+    if (scopes.Frames.empty()) return;
+
+    scopes.Prefix.resize(scopes.Frames.back().ParentPrefixLength);
+    scopes.Frames.pop_back();
+
+    if (m_bBinary)
+    {
+        char buffer[16];
+        BinLog::BINLOG_WRITER w{ buffer, sizeof(buffer) };
+        w.BeginRecord(BinLog::RecordKind::ScopeEnd);
+        w.Put(ReadTicks());
+        w.Put(ThreadId());
+        PushStructure(w.EndRecord());
+    }
 }
 
-std::string Logger::BuildPrefix(const bool isNodeLine) const
+void Logger::IncreaseTab()
 {
-    // Style chars
-    const bool unicode = (m_indentStyle == IndentStyle::Unicode);
-    const char* V  = unicode ? "│   " : "|   ";
-    const char* T  = unicode ? "├── " : "|-- ";
-    const char* L  = unicode ? "└── " : "`-- ";
-    const char* SP = "    ";
+    ++ThreadScopes().Tabs;
+    if (IsInitialized() && Get().m_bBinary) Get().WriteBinaryTab(+1);
+}
 
-    std::string pre;
+void Logger::DecreaseTab()
+{
+    uint8_t& tabs = ThreadScopes().Tabs;
+    if (tabs == 0) return;
+    --tabs;
+    if (IsInitialized() && Get().m_bBinary) Get().WriteBinaryTab(-1);
+}
 
-    // Draw vertical guides for ancestor levels
-    if (!m_scopeHasNext.empty())
-    {
-        for (size_t i = 0; i + 1 < m_scopeHasNext.size(); ++i)
-            pre += (m_scopeHasNext[i] ? V : SP);
+void Logger::WriteBinaryTab(const int8_t delta)
+{
+    char buffer[16];
+    BinLog::BINLOG_WRITER w{ buffer, sizeof(buffer) };
+    w.BeginRecord(BinLog::RecordKind::Tab);
+    w.Put(ReadTicks());
+    w.Put(ThreadId());
+    w.Put(delta);
+    PushStructure(w.EndRecord());
+}
 
-        // For the current level:
-        if (isNodeLine) {
-            // node header uses ├── or └──
-            pre += (m_scopeHasNext.back() ? T : L);
-        } else {
-            // regular log line inside scope: keep vertical if ancestors have next
-            pre += (m_scopeHasNext.back() ? V : SP);
-        }
-    }
+uint32_t Logger::RegisterCallSite(LOG_CALL_SITE& site, const LogLevel level, const std::string_view fmt)
+{
+    std::scoped_lock lock(m_callSiteMutex);
+
+    // another thread may have won the race while we waited
+    if (const uint32_t id = site.Id.load(std::memory_order_acquire)) return id;
+
+    const uint32_t id = m_nNextCallSiteId++;
+
+    char buffer[LOG_RECORD_CAPACITY];
+    BinLog::BINLOG_WRITER w{ buffer, sizeof(buffer) };
+    w.BeginRecord(BinLog::RecordKind::Define);
+    w.PutVarint(id);
+    w.Put(static_cast<uint8_t>(level));
+    w.PutVarint(site.Line);
+    w.PutString(site.File ? site.File : "");
+    w.PutString(fmt);
+
+    // definitions skip the queue, an overflow policy dropping one would leave its messages undecodable.
+    // The writer picks them up before the first record it sees after this point, so before any message with the id.
+    m_pendingCallSites.append(w.EndRecord());
+    m_bCallSitesPending.store(true, std::memory_order_release);
+    site.Id.store(id, std::memory_order_release);
+    return id;
+}
+
+void Logger::WritePendingCallSites()
+{
+    std::scoped_lock lock(m_callSiteMutex);
+    m_bCallSitesPending.store(false, std::memory_order_relaxed);
+    WriteToSinks(LogLevel::Print, m_pendingCallSites);
+    m_pendingCallSites.clear();
+}
+
+void Logger::WriteBinaryHeader() const
+{
+    BinLog::BINLOG_FILE_HEADER header{};
+    std::memcpy(header.Magic, BinLog::FILE_MAGIC, sizeof(header.Magic));
+    header.Version     = BinLog::FILE_VERSION;
+    header.IndentStyle = static_cast<uint8_t>(m_indentStyle);
+
+    header.TickFrequency = FastClock::GetFrequency();
+    header.StartTicks    = ReadTicks();
+    header.StartUnixMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    m_logFile.WriteBytes(&header, sizeof(header));
+}
+
+void Logger::WriteBinaryText(const LogLevel level, const std::string_view text)
+{
+    char buffer[LOG_RECORD_CAPACITY];
+    BinLog::BINLOG_WRITER w{ buffer, sizeof(buffer) };
+    w.BeginRecord(BinLog::RecordKind::Text);
+    w.Put(ReadTicks());
+    w.Put(ThreadId());
+    w.Put(static_cast<uint8_t>(level));
+    w.PutString(text);
+    PushRecord(level, w.EndRecord());
+}
+
+uint32_t Logger::ThreadId()
+{
+    thread_local const uint32_t id = GetCurrentThreadId();
+    return id;
+}
+
+void Logger::AppendNodePrefix(LOG_LINE_BUFFER& line, const LOG_SCOPE_STACK& scopes) const
+{
+    if (scopes.Frames.empty()) return;
 
-    return pre;
+    // node header: ancestor guides, then ├── or └── for the current level
+    const LOG_SCOPE_FRAME& current = scopes.Frames.back();
+    const LOG_INDENT_GLYPHS& g     = GetIndentGlyphs(m_indentStyle);
+    line.Append(std::string_view{ scopes.Prefix }.substr(0, current.ParentPrefixLength));
+    line.Append(current.HasNext ? g.T : g.L);
 }
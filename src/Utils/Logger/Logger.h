@@ -7,30 +7,86 @@
 
 #include "Common/DefineWindows.h"
 #include "FileSystem/FileSystem.h"
+#include "LogTypes.h"
+#include "LogQueue.h"
+#include "BinaryLog.h"
+#include "FlightRecorder.h"
+#include "Timer/FastClock.h"
 
 #include <string>
 #include <mutex>
 #include <format>
-
-enum class IndentStyle : uint8_t { Unicode, ASCII };
-
-enum class LogLevel: uint8_t
-{
-    Info,
-    Warning,
-    Error,
-    Success,
-    Fail,
-    Print
-};
+#include <atomic>
+#include <thread>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include <string_view>
 
 typedef struct LOGGER_INIT_DESC
 {
     std::string FolderPath;
     std::string FilePrefix;
     bool EnableTerminal = false;
+
+    //~ Async backend: producers only format + enqueue, a writer thread owns console and file
+    bool              EnableAsync    = false;
+    uint32_t          QueueCapacity  = 1024; // rounded up to a power of two
+    LogOverflowPolicy OverflowPolicy = LogOverflowPolicy::DropOldest;
+
+    //~ Binary backend: records format id + raw args into a .binlog (implies async, no terminal text).
+    //~ Decode offline with the binlog-decoder tool.
+    bool EnableBinary = false;
 }LOGGER_INIT_DESC;
 
+//~ Per-thread scratch line, sized so a full line always fits a queue record
+typedef struct LOG_LINE_BUFFER
+{
+    char   Data[LOG_RECORD_CAPACITY];
+    size_t Size{ 0 };
+
+    //~ one byte is always held back for the trailing '\n'
+    size_t Remaining() const { return LOG_RECORD_CAPACITY - 1 - Size; }
+    char*  Cursor   ()       { return Data + Size; }
+
+    void Append(const std::string_view text)
+    {
+        const size_t n = std::min(text.size(), Remaining());
+        std::memcpy(Cursor(), text.data(), n);
+        Size += n;
+    }
+
+    void Append(const char ch, size_t count = 1)
+    {
+        count = std::min(count, Remaining());
+        std::memset(Cursor(), ch, count);
+        Size += count;
+    }
+
+    std::string_view View() const { return { Data, Size }; }
+} LOG_LINE_BUFFER;
+
+//~ One open LOG_SCOPE on the calling thread
+typedef struct LOG_SCOPE_FRAME
+{
+    size_t ParentPrefixLength; // prefix size before this scope added its guide
+    bool   HasNext;
+} LOG_SCOPE_FRAME;
+
+//~ Per-thread scope tree, the prefix is extended once per scope instead of rebuilt per line
+typedef struct LOG_SCOPE_STACK
+{
+    std::string                  Prefix; // body-line guides, one glyph per open scope
+    std::vector<LOG_SCOPE_FRAME> Frames;
+    uint8_t                      Tabs{ 0 };
+} LOG_SCOPE_STACK;
+
+//~ Per-category LOG_* guard, closed until Initialize so nothing is evaluated before a logger or recorder exists
+typedef struct LOG_CALL_SITE_GATE
+{
+    std::atomic<uint8_t> Threshold{ FOX_LOG_LEVEL_OFF };
+} LOG_CALL_SITE_GATE;
+
 /**
  * @brief Windows-specific, thread-safe singleton logger.
  */
@@ -45,96 +101,294 @@ public:
     static Logger& Get();
 
     template<typename... Args>
-        static void Info(std::format_string<Args...> fmt, Args&&... args)
+    static void Info(std::format_string<Args...> fmt, Args&&... args)
     {
         if (!IsInitialized()) return;
-        Get().Log(LogLevel::Info, std::format(fmt, std::forward<Args>(args)...));
+        Get().Write(LogLevel::Info, fmt, std::forward<Args>(args)...);
     }
 
     template<typename... Args>
     static void Warning(std::format_string<Args...> fmt, Args&&... args)
     {
         if (!IsInitialized()) return;
-        Get().Log(LogLevel::Warning, std::format(fmt, std::forward<Args>(args)...));
+        Get().Write(LogLevel::Warning, fmt, std::forward<Args>(args)...);
     }
 
     template<typename... Args>
     static void Error(std::format_string<Args...> fmt, Args&&... args)
     {
         if (!IsInitialized()) return;
-        Get().Log(LogLevel::Error, std::format(fmt, std::forward<Args>(args)...));
+        Get().Write(LogLevel::Error, fmt, std::forward<Args>(args)...);
     }
 
     template<typename... Args>
     static void Success(std::format_string<Args...> fmt, Args&&... args)
     {
         if (!IsInitialized()) return;
-        Get().Log(LogLevel::Success, std::format(fmt, std::forward<Args>(args)...));
+        Get().Write(LogLevel::Success, fmt, std::forward<Args>(args)...);
     }
 
     template<typename... Args>
     static void Fail(std::format_string<Args...> fmt, Args&&... args)
     {
         if (!IsInitialized()) return;
-        Get().Log(LogLevel::Fail, std::format(fmt, std::forward<Args>(args)...));
+        Get().Write(LogLevel::Fail, fmt, std::forward<Args>(args)...);
     }
 
     template<typename... Args>
     static void Print(std::format_string<Args...> fmt, Args&&... args)
     {
         if (!IsInitialized()) return;
-        Get().Log(LogLevel::Print, std::format(fmt, std::forward<Args>(args)...));
+        Get().Write(LogLevel::Print, fmt, std::forward<Args>(args)...);
+    }
+
+    //~ Whether the regular sinks take this level, what Submit and LOG_ENABLED test
+    static bool IsEnabled(const LogCategory category, const LogLevel level)
+    {
+        return GetLevelSeverity(level) >=
+               m_categoryThresholds[static_cast<uint8_t>(category)].load(std::memory_order_relaxed)
+            && IsInitialized();
+    }
+
+    //~ The LOG_* macro guard: one relaxed load of the lower of the category and flight recorder thresholds
+    static bool ShouldSubmit(const LogCategory category, const LogLevel level)
+    {
+        return GetLevelSeverity(level) >= m_callSiteGates[static_cast<uint8_t>(category)].Threshold.load(std::memory_order_relaxed);
+    }
+
+    //~ severity is one of FOX_LOG_LEVEL_*, FOX_LOG_LEVEL_OFF silences the category
+    static void SetCategoryLevel(const LogCategory category, const uint8_t severity)
+    {
+        m_categoryThresholds[static_cast<uint8_t>(category)].store(severity, std::memory_order_relaxed);
+        RefreshCallSiteGates();
+    }
+
+    //~ Recomputes the macro guards, called whenever a category threshold, the logger or the flight recorder changes
+    static void RefreshCallSiteGates();
+
+    //~ Entry point of the LOG_* macros, the call site lets binary mode skip formatting entirely.
+    //~ The flight recorder applies its own severity threshold, category filters only apply to the regular sinks.
+    template<typename... Args>
+    static void Submit(LOG_CALL_SITE& site, const LogCategory category, const LogLevel level,
+                       std::format_string<Args...> fmt, Args&&... args)
+    {
+        FlightRecorder::Record(site, level, fmt.get(), args...);
+        if (!IsInitialized() || !IsEnabled(category, level)) return;
+
+        Logger& logger = Get();
+        if (logger.m_bBinary) logger.WriteBinary(site, level, fmt.get(), args...);
+        else                  logger.Write(level, fmt, std::forward<Args>(args)...);
     }
 
-    static void IncreaseTab() { ++m_nTabs; }
-    static void DecreaseTab() { if (m_nTabs > 0) --m_nTabs; }
+    static void IncreaseTab();
+    static void DecreaseTab();
 
     static std::string GetTimestamp();
 
+    //~ Blocks until everything logged so far reached the console and disk (crash paths)
+    static void Flush();
+    _fox_Return_enforce static uint64_t GetDroppedCount();
+
+    //~ Scopes that are already open keep the glyphs they were entered with
     static void SetIndentStyle(IndentStyle s) { Get().m_indentStyle = s; }
 
     // Tree-style scoping
-    static void BeginScope(const std::string& name, bool hasNextSibling = false) { Get().BeginScopeImpl(name, hasNextSibling); }
-    static void EndScope() { Get().EndScopeImpl(); }
+    static void BeginScope(std::string_view name, bool hasNextSibling = false)
+    {
+        if (IsInitialized()) Get().BeginScopeImpl(name, hasNextSibling);
+    }
+    static void EndScope() { if (IsInitialized()) Get().EndScopeImpl(); }
 
 private:
     explicit Logger(const LOGGER_INIT_DESC& desc);
 
-    void Log(LogLevel level, const std::string& msg);
+    //~ Formats straight into the calling thread's line buffer, no heap allocation
+    template<typename... Args>
+    void Write(LogLevel level, std::format_string<Args...> fmt, Args&&... args);
+
+    static LOG_LINE_BUFFER& ThreadLineBuffer();
+    static LOG_SCOPE_STACK& ThreadScopes();
+    void BeginLine(LOG_LINE_BUFFER& line, LogLevel level) const;
+    void CommitLine(LogLevel level, LOG_LINE_BUFFER& line);
     void SetConsoleColor(LogLevel level) const;
+    static std::string_view LevelPrefix(LogLevel level);
+
+    // binary backend
+    template<typename... Args>
+    void WriteBinary(LOG_CALL_SITE& site, LogLevel level, std::string_view fmt, const Args&... args);
+
+    uint32_t RegisterCallSite(LOG_CALL_SITE& site, LogLevel level, std::string_view fmt);
+    void     WritePendingCallSites();
+    void     WriteBinaryHeader() const;
+    void     WriteBinaryText(LogLevel level, std::string_view text);
+    void     WriteBinaryTab (int8_t delta);
+    void     PushRecord(LogLevel level, std::string_view bytes);
+    void     PushStructure(std::string_view bytes);
+    static uint64_t ReadTicks() { return FastClock::Now(); }
+    static uint32_t ThreadId();
     void EnableTerminal();
 
+    // async backend
+    void WriterLoop(const std::stop_token& stopToken);
+    bool DrainQueue();
+    void WriteToSinks(LogLevel level, std::string_view text);
+
     // helpers
-    void BeginScopeImpl(const std::string& name, bool hasNextSibling);
+    void BeginScopeImpl(std::string_view name, bool hasNextSibling);
     void EndScopeImpl();
-    std::string BuildPrefix(bool isNodeLine) const;
+    void AppendNodePrefix(LOG_LINE_BUFFER& line, const LOG_SCOPE_STACK& scopes) const;
 
 private:
-    inline static uint8_t m_nTabs{ 0 };
+    inline static std::atomic<uint8_t> m_categoryThresholds[static_cast<uint8_t>(LogCategory::Count)]{};
+    inline static LOG_CALL_SITE_GATE m_callSiteGates[static_cast<uint8_t>(LogCategory::Count)]{};
+    inline static std::mutex         m_gateMutex;
     static std::unique_ptr<Logger> m_pInstance;
     std::mutex m_mutex;
     HANDLE m_hConsole{ nullptr };
     bool m_bTerminalEnabled{ false };
     FileSystem m_logFile{};
 
-    std::vector<bool> m_scopeHasNext;
-    IndentStyle       m_indentStyle{ IndentStyle::Unicode };
+    // async backend
+    std::unique_ptr<LogQueue> m_pQueue{ nullptr };
+    LogOverflowPolicy         m_overflowPolicy{ LogOverflowPolicy::DropOldest };
+    std::atomic<uint64_t>     m_nPendingSignal{ 0 };
+    std::atomic<bool>         m_bWriterParked { false };
+    std::mutex                m_sinkMutex;
+    std::string               m_fileBatch;
+    uint64_t                  m_nReportedDrops{ 0 };
+    std::jthread              m_writerThread;
+
+    // binary backend
+    bool              m_bBinary{ false };
+    std::mutex        m_callSiteMutex;
+    uint32_t          m_nNextCallSiteId{ 1 };
+    std::string       m_pendingCallSites;            // Define records waiting for the writer, guarded by m_callSiteMutex
+    std::atomic<bool> m_bCallSitesPending{ false };
+
+    IndentStyle m_indentStyle{ IndentStyle::Unicode };
 };
 
+template<typename... Args>
+void Logger::Write(const LogLevel level, std::format_string<Args...> fmt, Args&&... args)
+{
+    LOG_LINE_BUFFER& line = ThreadLineBuffer();
+
+    if (m_bBinary)
+    {
+        // no call site to key on, ship the formatted text instead
+        const auto result = std::format_to_n(line.Data, static_cast<std::ptrdiff_t>(LOG_RECORD_CAPACITY),
+                                             fmt, std::forward<Args>(args)...);
+        WriteBinaryText(level, { line.Data, std::min(static_cast<size_t>(result.size), LOG_RECORD_CAPACITY) });
+        return;
+    }
+
+    // the sync path still serialises the whole line so console colours don't interleave
+    std::unique_lock lock(m_mutex, std::defer_lock);
+    if (!m_pQueue) lock.lock();
+
+    BeginLine(line, level);
+    const auto result = std::format_to_n(line.Cursor(), static_cast<std::ptrdiff_t>(line.Remaining()),
+                                         fmt, std::forward<Args>(args)...);
+    line.Size += std::min(static_cast<size_t>(result.size), line.Remaining());
+
+    CommitLine(level, line);
+}
+
+template<typename... Args>
+void Logger::WriteBinary(LOG_CALL_SITE& site, const LogLevel level, const std::string_view fmt, const Args&... args)
+{
+    uint32_t id = site.Id.load(std::memory_order_acquire);
+    if (id == 0) id = RegisterCallSite(site, level, fmt);
+
+    LOG_LINE_BUFFER& line = ThreadLineBuffer();
+    BinLog::BINLOG_WRITER w{ line.Data, LOG_RECORD_CAPACITY };
+
+    w.BeginRecord(BinLog::RecordKind::Message);
+    w.PutVarint(id);
+    w.Put(ReadTicks());
+    w.Put(ThreadId());
+    (BinLog::EncodeArg(w, args), ...);
+
+    PushRecord(level, w.EndRecord());
+}
+
 // global access macros
 #define INIT_GLOBAL_LOGGER(desc) Logger::Initialize(desc)
 #define TERMINATE_GLOBAL_LOGGER() Logger::Terminate()
+#define FLUSH_GLOBAL_LOGGER()     Logger::Flush()
+
+#define FOX_LOG_AT(category, level, ...) \
+    do { if (Logger::ShouldSubmit(category, level)) { \
+         static constinit LOG_CALL_SITE _foxLogSite{ __FILE__, __LINE__ }; \
+         Logger::Submit(_foxLogSite, category, level, __VA_ARGS__); } } while (0)
+
+#define FOX_LOG_STRIPPED(...) do {} while (0)
+
+#define LOG_ENABLED(category, level) \
+    (LOG_LEVEL_COMPILED_IN<LogLevel::level> && Logger::IsEnabled(LogCategory::category, LogLevel::level))
+
+#if FOX_LOG_MIN_LEVEL <= FOX_LOG_LEVEL_VERBOSE
+    #define LOG_PRINT_CAT(category, ...)   FOX_LOG_AT(LogCategory::category, LogLevel::Print,   __VA_ARGS__)
+#else
+    #define LOG_PRINT_CAT(category, ...)   FOX_LOG_STRIPPED()
+#endif
 
-#define LOG_INFO(...)       Logger::Info(__VA_ARGS__)
-#define LOG_PRINT(...)      Logger::Print(__VA_ARGS__)
-#define LOG_WARNING(...)    Logger::Warning(__VA_ARGS__)
-#define LOG_ERROR(...)      Logger::Error(__VA_ARGS__)
-#define LOG_SUCCESS(...)    Logger::Success(__VA_ARGS__)
-#define LOG_FAIL(...)       Logger::Fail(__VA_ARGS__)
+#if FOX_LOG_MIN_LEVEL <= FOX_LOG_LEVEL_INFO
+    #define LOG_INFO_CAT(category, ...)    FOX_LOG_AT(LogCategory::category, LogLevel::Info,    __VA_ARGS__)
+    #define LOG_SUCCESS_CAT(category, ...) FOX_LOG_AT(LogCategory::category, LogLevel::Success, __VA_ARGS__)
+#else
+    #define LOG_INFO_CAT(category, ...)    FOX_LOG_STRIPPED()
+    #define LOG_SUCCESS_CAT(category, ...) FOX_LOG_STRIPPED()
+#endif
+
+#if FOX_LOG_MIN_LEVEL <= FOX_LOG_LEVEL_WARNING
+    #define LOG_WARNING_CAT(category, ...) FOX_LOG_AT(LogCategory::category, LogLevel::Warning, __VA_ARGS__)
+#else
+    #define LOG_WARNING_CAT(category, ...) FOX_LOG_STRIPPED()
+#endif
+
+#if FOX_LOG_MIN_LEVEL <= FOX_LOG_LEVEL_ERROR
+    #define LOG_ERROR_CAT(category, ...)   FOX_LOG_AT(LogCategory::category, LogLevel::Error,   __VA_ARGS__)
+    #define LOG_FAIL_CAT(category, ...)    FOX_LOG_AT(LogCategory::category, LogLevel::Fail,    __VA_ARGS__)
+#else
+    #define LOG_ERROR_CAT(category, ...)   FOX_LOG_STRIPPED()
+    #define LOG_FAIL_CAT(category, ...)    FOX_LOG_STRIPPED()
+#endif
+
+#define LOG_INFO(...)       LOG_INFO_CAT   (General, __VA_ARGS__)
+#define LOG_PRINT(...)      LOG_PRINT_CAT  (General, __VA_ARGS__)
+#define LOG_WARNING(...)    LOG_WARNING_CAT(General, __VA_ARGS__)
+#define LOG_ERROR(...)      LOG_ERROR_CAT  (General, __VA_ARGS__)
+#define LOG_SUCCESS(...)    LOG_SUCCESS_CAT(General, __VA_ARGS__)
+#define LOG_FAIL(...)       LOG_FAIL_CAT   (General, __VA_ARGS__)
 #define LOG_ADD_TAB()       Logger::IncreaseTab()
 #define LOG_REMOVE_TAB()    Logger::DecreaseTab()
 
-#define LOG_SCOPE(name, hasNext) Logger::BeginScope(name, hasNext)
-#define LOG_SCOPE_END()          Logger::EndScope()
+/**
+ * @brief Closes its LOG_SCOPE on every exit path, early returns and exceptions included.
+ */
+class LogScopeGuard
+{
+public:
+    LogScopeGuard(const std::string_view name, const bool hasNextSibling)
+        : m_bOpen(Logger::IsInitialized())
+    {
+        if (m_bOpen) Logger::BeginScope(name, hasNextSibling);
+    }
+    ~LogScopeGuard() { if (m_bOpen) Logger::EndScope(); }
+
+    LogScopeGuard(const LogScopeGuard&)            = delete;
+    LogScopeGuard& operator=(const LogScopeGuard&) = delete;
+
+private:
+    bool m_bOpen;
+};
+
+#define FOX_LOG_CONCAT_IMPL(a, b) a##b
+#define FOX_LOG_CONCAT(a, b)      FOX_LOG_CONCAT_IMPL(a, b)
+
+#define LOG_SCOPE(name, hasNext)       Logger::BeginScope(name, hasNext)
+#define LOG_SCOPE_END()                Logger::EndScope()
+#define LOG_SCOPE_GUARD(name, hasNext) LogScopeGuard FOX_LOG_CONCAT(_foxLogScope, __LINE__){ name, hasNext }
 
 #endif //LOGGER_H
@@ -0,0 +1,180 @@
+#include "FrameStatistics.h"
+#include "FileSystem/FileSystem.h"
+#include "Logger/Logger.h"
+#include "Timer/FastClock.h"
+
+#include <algorithm>
+#include <format>
+#include <iterator>
+
+FrameStatistics::FrameStatistics(const FRAME_STATISTICS_DESC& desc)
+    : m_desc(desc)
+{
+    m_desc.WindowFrames  = std::max(m_desc.WindowFrames, 1u);
+    m_desc.WindowHistory = std::max(m_desc.WindowHistory, 1u);
+    m_channels.reserve(m_desc.MaxChannels);
+
+    m_fNanosecondsPerTick = 1e9 / static_cast<double>(FastClock::GetFrequency());
+}
+
+uint32_t FrameStatistics::AddChannel(const std::string& name)
+{
+    for (uint32_t i = 0; i < m_channels.size(); ++i)
+        if (m_channels[i]->Name == name) return i;
+
+    if (m_channels.size() >= m_desc.MaxChannels)
+    {
+        LOG_WARNING("[FrameStatistics] Channel limit ({}) reached, {} is not recorded", m_desc.MaxChannels, name);
+        return INVALID_CHANNEL;
+    }
+
+    //~ histograms are ~15 KB each, keep them off the vector so growth never moves them
+    auto channel = std::make_unique<CHANNEL>();
+    channel->Name = name;
+    channel->History.resize(m_desc.WindowHistory);
+
+    m_channels.emplace_back(std::move(channel));
+    return static_cast<uint32_t>(m_channels.size() - 1);
+}
+
+void FrameStatistics::Record(const uint32_t channel, const uint64_t nanoseconds)
+{
+    if (channel >= m_channels.size()) return;
+
+    CHANNEL& target = *m_channels[channel];
+    target.Window.Record(nanoseconds);
+    target.Total .Record(nanoseconds);
+}
+
+void FrameStatistics::RecordTicks(const uint32_t channel, const uint64_t fastClockTicks)
+{
+    Record(channel, static_cast<uint64_t>(static_cast<double>(fastClockTicks) * m_fNanosecondsPerTick));
+}
+
+void FrameStatistics::EndFrame()
+{
+    if (++m_nFramesInWindow >= m_desc.WindowFrames) CloseWindow();
+}
+
+PERCENTILE_SUMMARY FrameStatistics::GetWindowSummary(const uint32_t channel) const
+{
+    return channel < m_channels.size() ? m_channels[channel]->LastWindow : PERCENTILE_SUMMARY{};
+}
+
+PERCENTILE_SUMMARY FrameStatistics::GetTotalSummary(const uint32_t channel) const
+{
+    return channel < m_channels.size() ? Summarize(m_channels[channel]->Total) : PERCENTILE_SUMMARY{};
+}
+
+bool FrameStatistics::ExportCsv(const std::string& path) const
+{
+    FileSystem file;
+    if (!file.OpenForWrite(path)) return false;
+
+    file.WritePlainText("channel,window,count,mean_ms,p50_ms,p90_ms,p99_ms,p999_ms,max_ms\n");
+
+    auto writeRow = [&file](const std::string& name, const std::string& window, const PERCENTILE_SUMMARY& s)
+    {
+        file.WritePlainText(std::format("{},{},{},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f}\n",
+            name, window, s.Count, s.Mean, s.P50, s.P90, s.P99, s.P999, s.Max));
+    };
+
+    const uint64_t kept  = std::min<uint64_t>(m_nClosedWindows, m_desc.WindowHistory);
+    const uint64_t first = m_nClosedWindows - kept;
+
+    for (const auto& channel : m_channels)
+    {
+        for (uint64_t window = first; window < m_nClosedWindows; ++window)
+            writeRow(channel->Name, std::to_string(window), channel->History[window % m_desc.WindowHistory]);
+
+        writeRow(channel->Name, "total", Summarize(channel->Total));
+    }
+
+    file.Flush();
+    file.Close();
+    return true;
+}
+
+bool FrameStatistics::ExportJson(const std::string& path) const
+{
+    FileSystem file;
+    if (!file.OpenForWrite(path)) return false;
+
+    //~ built whole and written once, WritePlainText would end every fragment with its own newline
+    std::string json;
+    auto out = std::back_inserter(json);
+
+    auto writeSummary = [&out](const PERCENTILE_SUMMARY& s)
+    {
+        std::format_to(out,
+            R"({{"count":{},"mean_ms":{:.4f},"p50_ms":{:.4f},"p90_ms":{:.4f},"p99_ms":{:.4f},"p999_ms":{:.4f},"max_ms":{:.4f}}})",
+            s.Count, s.Mean, s.P50, s.P90, s.P99, s.P999, s.Max);
+    };
+
+    const uint64_t kept  = std::min<uint64_t>(m_nClosedWindows, m_desc.WindowHistory);
+    const uint64_t first = m_nClosedWindows - kept;
+
+    std::format_to(out, "{{\n  \"window_frames\": {},\n  \"first_window\": {},\n  \"channels\": [\n",
+        m_desc.WindowFrames, first);
+
+    for (size_t i = 0; i < m_channels.size(); ++i)
+    {
+        const CHANNEL& channel = *m_channels[i];
+
+        //~ channel names come from system names, nothing that needs escaping
+        std::format_to(out, "    {{\n      \"name\": \"{}\",\n      \"total\": ", channel.Name);
+        writeSummary(Summarize(channel.Total));
+        json += ",\n      \"windows\": [";
+
+        for (uint64_t window = first; window < m_nClosedWindows; ++window)
+        {
+            json += window == first ? "\n        " : ",\n        ";
+            writeSummary(channel.History[window % m_desc.WindowHistory]);
+        }
+
+        json += i + 1 < m_channels.size() ? "\n      ]\n    },\n" : "\n      ]\n    }\n";
+    }
+    json += "  ]\n}\n";
+
+    const bool written = file.WriteBytes(json.data(), json.size());
+    file.Flush();
+    file.Close();
+    return written;
+}
+
+void FrameStatistics::ExportAll()
+{
+    //~ a partial window still says something about the last seconds before shutdown
+    if (m_nFramesInWindow != 0) CloseWindow();
+
+    if (!ExportCsv(m_desc.CsvPath))   LOG_WARNING("[FrameStatistics] Failed to write {}", m_desc.CsvPath);
+    if (!ExportJson(m_desc.JsonPath)) LOG_WARNING("[FrameStatistics] Failed to write {}", m_desc.JsonPath);
+}
+
+PERCENTILE_SUMMARY FrameStatistics::Summarize(const LatencyHistogram& histogram)
+{
+    constexpr double toMs = 1e-6;
+
+    PERCENTILE_SUMMARY summary{};
+    summary.Count = histogram.GetCount();
+    summary.Mean  = histogram.GetMean() * toMs;
+    summary.P50   = static_cast<double>(histogram.ValueAtPercentile(50.0))  * toMs;
+    summary.P90   = static_cast<double>(histogram.ValueAtPercentile(90.0))  * toMs;
+    summary.P99   = static_cast<double>(histogram.ValueAtPercentile(99.0))  * toMs;
+    summary.P999  = static_cast<double>(histogram.ValueAtPercentile(99.9))  * toMs;
+    summary.Max   = static_cast<double>(histogram.GetMax()) * toMs;
+    return summary;
+}
+
+void FrameStatistics::CloseWindow()
+{
+    for (const auto& channel : m_channels)
+    {
+        channel->LastWindow = Summarize(channel->Window);
+        channel->History[m_nClosedWindows % m_desc.WindowHistory] = channel->LastWindow;
+        channel->Window.Reset();
+    }
+
+    ++m_nClosedWindows;
+    m_nFramesInWindow = 0;
+}
@@ -0,0 +1,86 @@
+#ifndef FRAMESTATISTICS_H
+#define FRAMESTATISTICS_H
+
+#include "LatencyHistogram.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+typedef struct FRAME_STATISTICS_DESC
+{
+    uint32_t    WindowFrames  = 600;  // frames per rolling window, frame counted so runs compare frame for frame
+    uint32_t    WindowHistory = 256;  // closed windows kept per channel for the export
+    uint32_t    MaxChannels   = 64;
+    std::string CsvPath       = "Logs\\FrameStats.csv";
+    std::string JsonPath      = "Logs\\FrameStats.json";
+} FRAME_STATISTICS_DESC;
+
+//~ Milliseconds
+typedef struct PERCENTILE_SUMMARY
+{
+    uint64_t Count{ 0 };
+    double   Mean { 0.0 };
+    double   P50  { 0.0 };
+    double   P90  { 0.0 };
+    double   P99  { 0.0 };
+    double   P999 { 0.0 };
+    double   Max  { 0.0 };
+} PERCENTILE_SUMMARY;
+
+/**
+ * @brief Named latency channels (frame CPU time, per system update...), each with a rolling window
+ *        histogram and a whole-run histogram. Channels are created up front, Record and EndFrame
+ *        never allocate. Main thread only.
+ */
+class FrameStatistics
+{
+public:
+    static constexpr uint32_t INVALID_CHANNEL = UINT32_MAX;
+
+    explicit FrameStatistics(const FRAME_STATISTICS_DESC& desc = {});
+    ~FrameStatistics() = default;
+
+    FrameStatistics(const FrameStatistics&)            = delete;
+    FrameStatistics& operator=(const FrameStatistics&) = delete;
+
+    //~ Setup time only, INVALID_CHANNEL once MaxChannels are taken
+    uint32_t AddChannel(const std::string& name);
+
+    void Record     (uint32_t channel, uint64_t nanoseconds);
+    void RecordTicks(uint32_t channel, uint64_t fastClockTicks);
+
+    //~ Closes the rolling window every WindowFrames calls
+    void EndFrame();
+
+    _fox_Return_enforce PERCENTILE_SUMMARY GetWindowSummary(uint32_t channel) const; // last closed window
+    _fox_Return_enforce PERCENTILE_SUMMARY GetTotalSummary (uint32_t channel) const;
+
+    bool ExportCsv (const std::string& path) const;
+    bool ExportJson(const std::string& path) const;
+
+    //~ Closes the open window and writes both files from the desc
+    void ExportAll();
+
+private:
+    struct CHANNEL
+    {
+        std::string                     Name;
+        LatencyHistogram                Window;
+        LatencyHistogram                Total;
+        std::vector<PERCENTILE_SUMMARY> History;      // ring, WindowHistory entries
+        PERCENTILE_SUMMARY              LastWindow{};
+    };
+
+    static PERCENTILE_SUMMARY Summarize(const LatencyHistogram& histogram);
+    void CloseWindow();
+
+private:
+    FRAME_STATISTICS_DESC                 m_desc;
+    std::vector<std::unique_ptr<CHANNEL>> m_channels;
+    double                                m_fNanosecondsPerTick{ 1.0 };
+    uint32_t                              m_nFramesInWindow    { 0 };
+    uint64_t                              m_nClosedWindows     { 0 };
+};
+
+#endif //FRAMESTATISTICS_H
@@ -0,0 +1,39 @@
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+void LatencyHistogram::Reset()
+{
+    m_counts.fill(0);
+    m_nCount = 0;
+    m_nSum   = 0;
+    m_nMax   = 0;
+    m_nMin   = UINT64_MAX;
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other)
+{
+    for (uint32_t i = 0; i < BUCKET_COUNT; ++i) m_counts[i] += other.m_counts[i];
+    m_nCount += other.m_nCount;
+    m_nSum   += other.m_nSum;
+    m_nMax    = std::max(m_nMax, other.m_nMax);
+    m_nMin    = std::min(m_nMin, other.m_nMin);
+}
+
+uint64_t LatencyHistogram::ValueAtPercentile(const double percentile) const
+{
+    if (m_nCount == 0) return 0;
+
+    const double   clamped = std::clamp(percentile, 0.0, 100.0);
+    const uint64_t target  = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(m_nCount))));
+
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        seen += m_counts[i];
+        //~ the top bucket is reported as the exact max instead of its midpoint
+        if (seen >= target) return std::min(BucketMidpoint(i), m_nMax);
+    }
+    return m_nMax;
+}
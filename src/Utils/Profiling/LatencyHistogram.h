@@ -0,0 +1,75 @@
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include "Common/Core.h"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+/**
+ * @brief HDR-style log-linear histogram of nanosecond durations.
+ *        Exact below 256 ns, then 128 buckets per power of two (<0.8% error) up to ~68 s.
+ *        Storage is inline, Record never allocates and is a handful of instructions.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS  = 8;
+    static constexpr uint32_t SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+    static constexpr uint32_t SUB_BUCKET_HALF  = SUB_BUCKET_COUNT / 2;
+    static constexpr uint32_t MAX_VALUE_BITS   = 36;
+    static constexpr uint64_t MAX_VALUE        = (1ull << MAX_VALUE_BITS) - 1;
+    static constexpr uint32_t BUCKET_COUNT     = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+
+    FORCELINE void Record(uint64_t nanoseconds)
+    {
+        if (nanoseconds > MAX_VALUE) nanoseconds = MAX_VALUE;
+
+        ++m_counts[BucketIndex(nanoseconds)];
+        ++m_nCount;
+        m_nSum += nanoseconds;
+        if (nanoseconds > m_nMax) m_nMax = nanoseconds;
+        if (nanoseconds < m_nMin) m_nMin = nanoseconds;
+    }
+
+    void Reset();
+    void Merge(const LatencyHistogram& other);
+
+    //~ percentile in [0, 100], bucket midpoint of the value that covers it
+    _fox_Return_enforce uint64_t ValueAtPercentile(double percentile) const;
+
+    _fox_Return_enforce uint64_t GetCount() const { return m_nCount; }
+    _fox_Return_enforce uint64_t GetMax  () const { return m_nMax; }
+    _fox_Return_enforce uint64_t GetMin  () const { return m_nCount ? m_nMin : 0; }
+    _fox_Return_enforce double   GetMean () const { return m_nCount ? static_cast<double>(m_nSum) / static_cast<double>(m_nCount) : 0.0; }
+
+    static constexpr uint32_t BucketIndex(const uint64_t value)
+    {
+        if (value < SUB_BUCKET_COUNT) return static_cast<uint32_t>(value);
+
+        const uint32_t shift = static_cast<uint32_t>(std::bit_width(value)) - SUB_BUCKET_BITS;
+        return shift * SUB_BUCKET_HALF + static_cast<uint32_t>(value >> shift);
+    }
+
+    static constexpr uint64_t BucketMidpoint(const uint32_t index)
+    {
+        if (index < SUB_BUCKET_COUNT) return index;
+
+        const uint32_t shift = index / SUB_BUCKET_HALF - 1;
+        const uint64_t sub   = index - shift * SUB_BUCKET_HALF;
+        return (sub << shift) + ((1ull << shift) >> 1);
+    }
+
+private:
+    std::array<uint32_t, BUCKET_COUNT> m_counts{};
+    uint64_t m_nCount{ 0 };
+    uint64_t m_nSum  { 0 };
+    uint64_t m_nMax  { 0 };
+    uint64_t m_nMin  { UINT64_MAX };
+};
+
+static_assert(LatencyHistogram::BucketIndex(LatencyHistogram::MAX_VALUE) == LatencyHistogram::BUCKET_COUNT - 1);
+static_assert(LatencyHistogram::BucketIndex(LatencyHistogram::BucketMidpoint(1000)) == 1000);
+
+#endif //LATENCYHISTOGRAM_H
@@ -0,0 +1,88 @@
+#include "FastClock.h"
+
+namespace
+{
+    typedef struct FAST_CLOCK_CALIBRATION
+    {
+        uint64_t Frequency;
+        uint64_t QpcFrequency;
+        uint64_t TscStart;
+        uint64_t QpcStart;
+    } FAST_CLOCK_CALIBRATION;
+
+    uint64_t ReadQpc()
+    {
+        LARGE_INTEGER ticks;
+        QueryPerformanceCounter(&ticks);
+        return static_cast<uint64_t>(ticks.QuadPart);
+    }
+
+    FAST_CLOCK_CALIBRATION Measure(const bool useTsc)
+    {
+        LARGE_INTEGER qpcFrequency;
+        QueryPerformanceFrequency(&qpcFrequency);
+
+        FAST_CLOCK_CALIBRATION calibration{};
+        calibration.QpcFrequency = static_cast<uint64_t>(qpcFrequency.QuadPart);
+        calibration.Frequency    = calibration.QpcFrequency;
+        if (!useTsc) return calibration;
+
+        //~ busy wait instead of Sleep, a descheduled thread would stretch one side of the window
+        unsigned int processor;
+        const uint64_t qpcStart = ReadQpc();
+        const uint64_t tscStart = __rdtscp(&processor);
+        const uint64_t window   = calibration.QpcFrequency / 50;
+
+        uint64_t qpcEnd = qpcStart;
+        while (qpcEnd - qpcStart < window) qpcEnd = ReadQpc();
+        const uint64_t tscEnd = __rdtscp(&processor);
+
+        const double tscPerQpc = static_cast<double>(tscEnd - tscStart) / static_cast<double>(qpcEnd - qpcStart);
+        calibration.Frequency  = static_cast<uint64_t>(tscPerQpc * static_cast<double>(calibration.QpcFrequency) + 0.5);
+        calibration.TscStart   = tscStart;
+        calibration.QpcStart   = qpcStart;
+        return calibration;
+    }
+
+    const FAST_CLOCK_CALIBRATION& Calibration()
+    {
+        static const FAST_CLOCK_CALIBRATION calibration = Measure(FastClock::IsTscInvariant());
+        return calibration;
+    }
+}
+
+uint64_t FastClock::GetFrequency()
+{
+    return Calibration().Frequency;
+}
+
+double FastClock::ToSeconds(const uint64_t ticks)
+{
+    return static_cast<double>(ticks) / static_cast<double>(Calibration().Frequency);
+}
+
+double FastClock::GetDriftPpm()
+{
+    if (!UseTsc()) return 0.0;
+
+    const FAST_CLOCK_CALIBRATION& calibration = Calibration();
+    const uint64_t tscNow = NowOrdered();
+    const uint64_t qpcNow = ReadQpc();
+
+    const double tscSeconds = static_cast<double>(tscNow - calibration.TscStart) / static_cast<double>(calibration.Frequency);
+    const double qpcSeconds = static_cast<double>(qpcNow - calibration.QpcStart) / static_cast<double>(calibration.QpcFrequency);
+    if (qpcSeconds <= 0.0) return 0.0;
+
+    return (tscSeconds - qpcSeconds) / qpcSeconds * 1e6;
+}
+
+bool FastClock::DetectInvariantTsc()
+{
+    int registers[4]{};
+    __cpuid(registers, 0x80000000);
+    if (static_cast<unsigned int>(registers[0]) < 0x80000007u) return false;
+
+    //~ CPUID.80000007H:EDX[8], constant rate across P/C states and synchronized between cores
+    __cpuid(registers, 0x80000007);
+    return (registers[3] & (1 << 8)) != 0;
+}
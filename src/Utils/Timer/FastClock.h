@@ -0,0 +1,62 @@
+#ifndef FASTCLOCK_H
+#define FASTCLOCK_H
+
+#include "Common/Core.h"
+#include "Common/DefineWindows.h"
+
+#include <cstdint>
+#include <intrin.h>
+
+/**
+ * @brief Cheap timebase for profiling scopes and log timestamps.
+ *        Reads the CPU timestamp counter when it is invariant (constant rate, synchronized across cores),
+ *        otherwise QueryPerformanceCounter, which is what steady_clock sits on anyway.
+ *        Ticks are only meaningful together with GetFrequency().
+ */
+class FastClock
+{
+public:
+    _fox_Return_enforce FORCELINE static uint64_t Now()
+    {
+        if (UseTsc()) return __rdtsc();
+
+        LARGE_INTEGER ticks;
+        QueryPerformanceCounter(&ticks);
+        return static_cast<uint64_t>(ticks.QuadPart);
+    }
+
+    //~ rdtscp waits for earlier instructions, use it to close a measured region
+    _fox_Return_enforce FORCELINE static uint64_t NowOrdered()
+    {
+        if (!UseTsc()) return Now();
+
+        unsigned int processor;
+        return __rdtscp(&processor);
+    }
+
+    //~ Ticks per second. The TSC rate is measured against QPC once (~20 ms), call Calibrate at startup to pay that early
+    _fox_Return_enforce static uint64_t GetFrequency();
+    static void Calibrate() { (void)GetFrequency(); }
+
+    _fox_Return_enforce static double ToSeconds     (uint64_t ticks);
+    _fox_Return_enforce static double ToMilliseconds(uint64_t ticks) { return ToSeconds(ticks) * 1e3; }
+    _fox_Return_enforce static double ToMicroseconds(uint64_t ticks) { return ToSeconds(ticks) * 1e6; }
+
+    _fox_Return_enforce static bool IsTscInvariant() { return UseTsc(); }
+
+    //~ How far the calibrated TSC has wandered from QPC since calibration, parts per million. 0 on the QPC path
+    _fox_Return_enforce static double GetDriftPpm();
+
+private:
+    static bool DetectInvariantTsc();
+
+    //~ Function-local so the first read decides, even from another translation unit's static initializer.
+    //~ A namespace-scope flag could still read false there and hand out QPC ticks before switching to the TSC
+    _fox_Return_enforce FORCELINE static bool UseTsc()
+    {
+        static const bool useTsc = DetectInvariantTsc();
+        return useTsc;
+    }
+};
+
+#endif //FASTCLOCK_H
@@ -7,9 +7,25 @@
 
 #include "Common/Core.h"
 #include <chrono>
-#include <mutex>
 #include <atomic>
+#include <cstdint>
 
+//~ One consistent reading of the timer, all four values come from the same Tick
+template<typename T>
+struct TIMER_SNAPSHOT
+{
+    T        Delta     { 0 };
+    T        Elapsed   { 0 };
+    T        Total     { 0 };
+    uint64_t FrameIndex{ 0 };
+};
+
+/**
+ * @brief Frame timer with a single writer and any number of readers.
+ *        Start/Stop/Pause/Resume/Reset/Tick must all come from the owning (main loop) thread,
+ *        they never block. Values are published through a seqlock, readers retry instead of
+ *        locking and never see the delta of one frame next to the total of another.
+ */
 template<typename T>
 class Timer
 {
@@ -20,122 +36,158 @@ public:
 
     void Reset()
     {
-        std::scoped_lock lock(m_threadMutex);
-
-        m_bPaused.store(false);
-        m_bRunning.store(false);
-
-        m_nElapsedTime.store(T{ 0 });
-        m_nTotalTime.store(T{ 0 });
-        m_nDeltaTime.store(T{ 0 });
+        m_bPaused  = false;
+        m_bRunning = false;
+        m_current  = {};
+        Publish();
     }
 
     void Tick()
     {
-        std::scoped_lock lock(m_threadMutex);
-
-        if (!m_bRunning.load() || m_bPaused.load())
+        if (!m_bRunning || m_bPaused)
             return;
 
         const auto now = Clock::now();
 
-        auto delta = std::chrono::duration_cast<std::chrono::duration<T>>(now - m_tpEndTime);
+        const T delta = std::chrono::duration_cast<std::chrono::duration<T>>(now - m_tpEndTime).count();
         m_tpEndTime = now;
-        m_nDeltaTime.store(delta.count());
-
-        auto elapsed = std::chrono::duration_cast<std::chrono::duration<T>>(now - m_tpStartTime);
-        m_nElapsedTime.store(elapsed.count());
 
-        m_nTotalTime.fetch_add(delta.count());
+        m_current.Delta   = delta;
+        m_current.Elapsed = std::chrono::duration_cast<std::chrono::duration<T>>(now - m_tpStartTime).count();
+        m_current.Total  += delta;
+        ++m_current.FrameIndex;
+        Publish();
     }
 
     void Start()
     {
-        std::scoped_lock lock(m_threadMutex);
-
         const auto now = Clock::now();
         m_tpStartTime = now;
         m_tpEndTime = now;
 
-        m_bRunning.store(true);
-        m_bPaused.store(false);
+        m_bRunning = true;
+        m_bPaused  = false;
     }
 
     void Stop()
     {
-        std::scoped_lock lock(m_threadMutex);
-
-        if (m_bRunning.load())
+        if (m_bRunning)
         {
             m_tpEndTime = Clock::now();
 
-            auto elapsed = std::chrono::duration_cast<std::chrono::duration<T>>(m_tpEndTime - m_tpStartTime);
-            m_nElapsedTime.store(elapsed.count());
-            m_nTotalTime.fetch_add(elapsed.count());
+            const T elapsed = std::chrono::duration_cast<std::chrono::duration<T>>(m_tpEndTime - m_tpStartTime).count();
+            m_current.Elapsed = elapsed;
+            m_current.Total  += elapsed;
+            Publish();
 
-            m_bRunning.store(false);
+            m_bRunning = false;
         }
     }
 
     void Pause()
     {
-        std::scoped_lock lock(m_threadMutex);
-
-        if (m_bRunning.load() && !m_bPaused.load())
+        if (m_bRunning && !m_bPaused)
         {
             m_tpPauseTime = Clock::now();
 
-            auto elapsed = std::chrono::duration_cast<std::chrono::duration<T>>(m_tpPauseTime - m_tpStartTime);
-            m_nElapsedTime.store(elapsed.count());
-            m_nTotalTime.fetch_add(elapsed.count());
+            const T elapsed = std::chrono::duration_cast<std::chrono::duration<T>>(m_tpPauseTime - m_tpStartTime).count();
+            m_current.Elapsed = elapsed;
+            m_current.Total  += elapsed;
+            Publish();
 
-            m_bPaused.store(true);
+            m_bPaused = true;
         }
     }
 
     void Resume()
     {
-        std::scoped_lock lock(m_threadMutex);
-
-        if (m_bRunning.load() && m_bPaused.load())
+        if (m_bRunning && m_bPaused)
         {
             const TimePoint resumeTime = Clock::now();
             m_tpStartTime = resumeTime;
-            m_bPaused.store(false);
+            m_bPaused = false;
+        }
+    }
+
+    //~ Safe from any thread
+    _fox_Return_enforce TIMER_SNAPSHOT<T> GetSnapshot() const
+    {
+        TIMER_SNAPSHOT<T> snapshot{};
+        for (;;)
+        {
+            const uint64_t before = m_sequence.load(std::memory_order_acquire);
+            if (before & 1) continue; // writer is mid publish, it never blocks so this is short
+
+            snapshot.Delta      = m_published.Delta.load(std::memory_order_relaxed);
+            snapshot.Elapsed    = m_published.Elapsed.load(std::memory_order_relaxed);
+            snapshot.Total      = m_published.Total.load(std::memory_order_relaxed);
+            snapshot.FrameIndex = m_published.FrameIndex.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == before) return snapshot;
         }
     }
 
-    _fox_Return_enforce T GetElapsedTime()
+    _fox_Return_enforce T GetElapsedTime() const
     {
-        return m_nElapsedTime.load();
+        return m_published.Elapsed.load(std::memory_order_acquire);
     }
 
-    _fox_Return_enforce T GetTotalTime()
+    _fox_Return_enforce T GetTotalTime() const
     {
-        return m_nTotalTime.load();
+        return m_published.Total.load(std::memory_order_acquire);
     }
 
-    _fox_Return_enforce float GetDeltaTime()
+    _fox_Return_enforce T GetDeltaTime() const
     {
-        return m_nDeltaTime.load();
+        return m_published.Delta.load(std::memory_order_acquire);
+    }
+
+    _fox_Return_enforce uint64_t GetFrameIndex() const
+    {
+        return m_published.FrameIndex.load(std::memory_order_acquire);
     }
 
 private:
-    using Clock = std::chrono::steady_clock;
-    using TimePoint = std::chrono::time_point<Clock>;
+    //~ Writer side of the seqlock: odd sequence while the fields are being replaced
+    void Publish()
+    {
+        const uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+        m_sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
 
-    mutable std::mutex m_threadMutex;
+        m_published.Delta.store(m_current.Delta, std::memory_order_relaxed);
+        m_published.Elapsed.store(m_current.Elapsed, std::memory_order_relaxed);
+        m_published.Total.store(m_current.Total, std::memory_order_relaxed);
+        m_published.FrameIndex.store(m_current.FrameIndex, std::memory_order_relaxed);
 
-    TimePoint m_tpStartTime{};
-    TimePoint m_tpEndTime{};
-    TimePoint m_tpPauseTime{};
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
 
-    std::atomic<T> m_nElapsedTime{};
-    std::atomic<T> m_nTotalTime{};
-    std::atomic<T> m_nDeltaTime{};
+private:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = std::chrono::time_point<Clock>;
 
-    std::atomic<bool> m_bPaused{ false };
-    std::atomic<bool> m_bRunning{ false };
+    //~ Relaxed atomics rather than plain fields, a reader racing the writer is expected, not UB
+    struct PUBLISHED_TIMES
+    {
+        std::atomic<T>        Delta     { 0 };
+        std::atomic<T>        Elapsed   { 0 };
+        std::atomic<T>        Total     { 0 };
+        std::atomic<uint64_t> FrameIndex{ 0 };
+    };
+
+    //~ Owned by the writer thread
+    TimePoint         m_tpStartTime{};
+    TimePoint         m_tpEndTime{};
+    TimePoint         m_tpPauseTime{};
+    TIMER_SNAPSHOT<T> m_current{};
+    bool              m_bPaused{ false };
+    bool              m_bRunning{ false };
+
+    //~ Shared with readers, kept off the writer's cache line
+    alignas(64) std::atomic<uint64_t> m_sequence{ 0 };
+    PUBLISHED_TIMES                   m_published{};
 };
 
 #endif //TIMER_H
@@ -77,7 +77,7 @@ void KeyboardSingleton::DebugKeysPressed() const
 
         char name[128]{};
         if (GetKeyNameTextA(lParam, name, static_cast<int>(sizeof(name))) > 0)
-            LOG_INFO("[KEY]: {} (VK: {})", name, key);
-        else LOG_INFO("[KEY]: Unknown (VK: {})", key);
+            LOG_INFO_CAT(Input, "[KEY]: {} (VK: {})", name, key);
+        else LOG_INFO_CAT(Input, "[KEY]: Unknown (VK: {})", key);
     }
 }
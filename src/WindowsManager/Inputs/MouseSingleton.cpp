@@ -164,21 +164,21 @@ void MouseSingleton::DebugKeysPressed() const
 
         switch (static_cast<EMouseButtons>(i))
         {
-        case EMouseButtons::MOUSE_LEFT:     LOG_INFO("[MOUSE]: Left Button Down");   break;
-        case EMouseButtons::MOUSE_RIGHT:    LOG_INFO("[MOUSE]: Right Button Down");  break;
-        case EMouseButtons::MOUSE_MIDDLE:   LOG_INFO("[MOUSE]: Middle Button Down"); break;
-        case EMouseButtons::MOUSE_WHEEL:    LOG_INFO("[MOUSE]: Wheel Pressed");      break;
-        case EMouseButtons::MOUSE_X1:       LOG_INFO("[MOUSE]: X1 Button Down");     break;
-        case EMouseButtons::MOUSE_X2:       LOG_INFO("[MOUSE]: X2 Button Down");     break;
+        case EMouseButtons::MOUSE_LEFT:     LOG_INFO_CAT(Input, "[MOUSE]: Left Button Down");   break;
+        case EMouseButtons::MOUSE_RIGHT:    LOG_INFO_CAT(Input, "[MOUSE]: Right Button Down");  break;
+        case EMouseButtons::MOUSE_MIDDLE:   LOG_INFO_CAT(Input, "[MOUSE]: Middle Button Down"); break;
+        case EMouseButtons::MOUSE_WHEEL:    LOG_INFO_CAT(Input, "[MOUSE]: Wheel Pressed");      break;
+        case EMouseButtons::MOUSE_X1:       LOG_INFO_CAT(Input, "[MOUSE]: X1 Button Down");     break;
+        case EMouseButtons::MOUSE_X2:       LOG_INFO_CAT(Input, "[MOUSE]: X2 Button Down");     break;
         default:
-            LOG_INFO("[MOUSE]: Unknown Button Index {}", i);
+            LOG_INFO_CAT(Input, "[MOUSE]: Unknown Button Index {}", i);
             break;
         }
     }
 
     if (IsMoved())
-        LOG_INFO("[MOUSE]: Position ({}, {})", m_descMouseState.GetX(), m_descMouseState.GetY());
+        LOG_INFO_CAT(Input, "[MOUSE]: Position ({}, {})", m_descMouseState.GetX(), m_descMouseState.GetY());
 
     if (IsScrolled())
-        LOG_INFO("[MOUSE]: Scrolled Wheel {}", m_descMouseState.WheelDelta);
+        LOG_INFO_CAT(Input, "[MOUSE]: Scrolled Wheel {}", m_descMouseState.WheelDelta);
 }
@@ -6,6 +6,7 @@
 #include "ExceptionHandler/WindowException.h"
 #include "Inputs/KeyboardSingleton.h"
 #include "Inputs/MouseSingleton.h"
+#include "Logger/Logger.h"
 
 WindowsManager::~WindowsManager()
 {
@@ -76,6 +77,7 @@ bool WindowsManager::InitWindow()
 
     if (!RegisterClassEx(&wc))
     {
+        LOG_ERROR_CAT(Window, "RegisterClassEx failed (error {})", GetLastError());
         return false;
     }
 
@@ -84,6 +86,7 @@ bool WindowsManager::InitWindow()
     RECT rect = m_descWindowSize.GetRect();
     if (!AdjustWindowRect(&rect, style, FALSE))
     {
+        LOG_ERROR_CAT(Window, "AdjustWindowRect failed (error {})", GetLastError());
         return false;
     }
 
@@ -110,6 +113,7 @@ bool WindowsManager::InitWindow()
     ShowWindow(m_hWnd, SW_SHOW);
     UpdateWindow(m_hWnd);
 
+    LOG_SUCCESS_CAT(Window, "Window created ({}x{} client area)", m_descWindowSize.Width, m_descWindowSize.Height);
     return true;
 }
 
@@ -130,6 +134,7 @@ LRESULT WindowsManager::MessageHandler(HWND hwnd, UINT msg, WPARAM wParam, LPARA
         desc.Width = width;
         SetWindowSize(desc);
 
+        LOG_PRINT_CAT(Window, "Resized to {}x{}", width, height);
         break;
     }
     case WM_SIZING:
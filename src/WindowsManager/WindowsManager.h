@@ -32,6 +32,9 @@ public:
     void OnUpdateEnd() override;
     void OnRelease() override;
 
+    //~ A window belongs to the thread that created it, ProcessMessages pumps the main thread's queue
+    _fox_Return_enforce bool RequiresMainThreadInit() const override { return true; }
+
     //~ Getters
     _fox_Return_enforce _fox_Ret_maybenull_ HWND      GetWinHandle    () const { return m_hWnd;      }
     _fox_Return_enforce _fox_Ret_maybenull_ HINSTANCE GetWinHInstance () const { return m_hInstance; }
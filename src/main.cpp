@@ -1,4 +1,6 @@
 #include "Engine/FoxPlayground.h"
+#include "FileSystem/VirtualFileSystem.h"
+#include "Timer/FastClock.h"
 #include <excpt.h>
 
 
@@ -30,28 +32,42 @@ int WINAPI WinMain(
     UNREFERENCED_PARAMETER(hPrevInstance);
     // SetUnhandledExceptionFilter(CrashHandler);
 
+    // measure the TSC rate before anything stamps a log record with it
+    FastClock::Calibrate();
+
+    // always on, release builds included: the only history we get after a crash
+    FLIGHT_RECORDER_DESC recorderDesc{};
+    recorderDesc.FilePath = F_TEXT("Logs\\FlightRecorder.fxfr");
+    INIT_FLIGHT_RECORDER(recorderDesc);
+
 #if defined(_DEBUG) || defined(ENABLE_TERMINAL)
     LOGGER_INIT_DESC logDesc{};
     logDesc.FilePrefix = F_TEXT("Log_");
     logDesc.FolderPath = F_TEXT("Logs");
     logDesc.EnableTerminal = true;
+    logDesc.EnableAsync    = true;
     INIT_GLOBAL_LOGGER(logDesc);
 #endif
 
     try
     {
+        // shipped builds carry assets.fxpk (pack_assets target), dev builds just read the loose copies
+        VirtualFileSystem::Mount(F_TEXT("assets.fxpk"));
+
         FoxPlayground playground{};
         if (not playground.Init()) return EXIT_FAILURE;
         return playground.Execute();
     }
     catch (const IException& e)
     {
+        FLUSH_GLOBAL_LOGGER();
         e.SaveCrashLog(F_TEXT("CrashReport"));
         MessageBox(nullptr, e.what(), F_TEXT("Error"), MB_OK | MB_ICONERROR);
         return EXIT_FAILURE;
     }
     catch (const std::exception& e)
     {
+        FLUSH_GLOBAL_LOGGER();
         MessageBox(nullptr, e.what(), F_TEXT("StdException"), MB_OK | MB_ICONERROR);
         return EXIT_FAILURE;
     }
@@ -0,0 +1,85 @@
+//
+// BinaryWriter over handles that cannot be written. The first failed write must stick:
+// Tell stops, later writes are dropped and Flush/Close report it instead of truncating quietly.
+//
+
+#include "FileSystem/BinaryWriter.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+    bool Check(const bool condition, const char* what)
+    {
+        if (!condition) std::printf("FAILED: %s\n", what);
+        return condition;
+    }
+
+    //~ More than one buffer's worth, so the writer has to hit the handle before Close
+    void WritePayload(BinaryWriter& writer)
+    {
+        const std::vector<uint32_t> values(256 * 1024, 0xF0F0F0F0u);
+        writer.WriteVector(values);
+        writer.WriteString("after the failure");
+    }
+
+    bool NeverOpened()
+    {
+        BinaryWriter writer;
+        WritePayload(writer);
+
+        bool ok = Check(writer.HasFailed(), "never opened: write reports failure");
+        ok &= Check(writer.Tell() == 0, "never opened: Tell does not count dropped bytes");
+        ok &= Check(!writer.Flush(), "never opened: Flush returns false");
+        ok &= Check(!writer.Close(), "never opened: Close returns false");
+        return ok;
+    }
+
+    bool OpenOnDirectory()
+    {
+        // CreateFile refuses a directory, the handle stays invalid
+        FileSystem::CreateDirectories(std::string("writer_failure_dir"));
+
+        BinaryWriter writer;
+        bool ok = Check(!writer.Open("writer_failure_dir"), "directory: Open fails");
+        WritePayload(writer);
+
+        ok &= Check(writer.HasFailed(), "directory: failure is sticky");
+        ok &= Check(writer.Tell() == 0, "directory: Tell stays at zero");
+        ok &= Check(!writer.Close(), "directory: Close returns false");
+
+        RemoveDirectory("writer_failure_dir");
+        return ok;
+    }
+
+    bool ReopenClearsFailure()
+    {
+        BinaryWriter writer;
+        WritePayload(writer);
+        (void)writer.Close();
+
+        bool ok = Check(writer.Open("writer_failure_ok.bin"), "reopen: Open succeeds");
+        ok &= Check(!writer.HasFailed(), "reopen: failure cleared");
+        WritePayload(writer);
+
+        const uint64_t written = writer.Tell();
+        ok &= Check(writer.Close(), "reopen: Close returns true");
+
+        ok &= Check(std::filesystem::file_size("writer_failure_ok.bin") == written, "reopen: file holds every byte");
+
+        FileSystem::DeleteFiles(std::string("writer_failure_ok.bin"));
+        return ok;
+    }
+}
+
+int main()
+{
+    const bool neverOpened = NeverOpened();
+    const bool directory   = OpenOnDirectory();
+    const bool reopen      = ReopenClearsFailure();
+    return neverOpened && directory && reopen ? EXIT_SUCCESS : EXIT_FAILURE;
+}
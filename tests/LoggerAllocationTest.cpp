@@ -0,0 +1,69 @@
+//
+// Counts heap allocations made by a batch of LOG_INFO calls once the logger is warm.
+// Formatting goes into a per-thread line buffer, so the steady state must not allocate.
+//
+
+#include "Logger/Logger.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<bool>     g_bCounting{ false };
+    std::atomic<uint64_t> g_nAllocations{ 0 };
+
+    void* CountedAllocate(const std::size_t size)
+    {
+        if (g_bCounting.load(std::memory_order_relaxed)) g_nAllocations.fetch_add(1, std::memory_order_relaxed);
+        if (void* pointer = std::malloc(size > 0 ? size : 1)) return pointer;
+        throw std::bad_alloc();
+    }
+
+    constexpr uint32_t BATCH_SIZE = 1000;
+
+    bool RunBatch(const char* mode, const bool async)
+    {
+        LOGGER_INIT_DESC desc{};
+        desc.FolderPath    = "Logs";
+        desc.FilePrefix    = "alloc_test";
+        desc.EnableAsync   = async;
+        desc.QueueCapacity = 4096; // the whole batch fits, nothing is dropped
+        Logger::Initialize(desc);
+
+        //~ first call per thread sets up the line buffer and the file sink
+        LOG_INFO("warm up {} {:.2f} {}", 1, 2.0, "three");
+        Logger::Flush();
+
+        g_nAllocations.store(0);
+        g_bCounting.store(true);
+        for (uint32_t i = 0; i < BATCH_SIZE; ++i)
+        {
+            LOG_INFO("frame {} took {:.3f} ms on {}", i, static_cast<double>(i) * 0.25, "main");
+        }
+        g_bCounting.store(false);
+
+        Logger::Terminate();
+
+        const uint64_t allocations = g_nAllocations.load();
+        std::printf("%s: %llu allocation(s) over %u LOG_INFO calls\n", mode,
+            static_cast<unsigned long long>(allocations), BATCH_SIZE);
+        return allocations == 0;
+    }
+}
+
+void* operator new(const std::size_t size)                    { return CountedAllocate(size); }
+void* operator new[](const std::size_t size)                  { return CountedAllocate(size); }
+void  operator delete(void* pointer) noexcept                 { std::free(pointer); }
+void  operator delete[](void* pointer) noexcept               { std::free(pointer); }
+void  operator delete(void* pointer, std::size_t) noexcept    { std::free(pointer); }
+void  operator delete[](void* pointer, std::size_t) noexcept  { std::free(pointer); }
+
+int main()
+{
+    const bool sync  = RunBatch("sync",  false);
+    const bool async = RunBatch("async", true);
+    return sync && async ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,111 @@
+//
+// Mounts hand-built packs whose table of contents points past the end of the file. Offsets near
+// 2^64 used to wrap the bounds sums and pass, every one of these has to be refused at Mount.
+//
+
+#include "FileSystem/VirtualFileSystem.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr std::string_view NAME    = "a.txt";
+    constexpr std::string_view CONTENT = "hi";
+    constexpr uint64_t         NEAR_END = ~uint64_t{ 0 } - 31; // + one entry wraps to 0
+
+    //~ One entry, two buckets, names, then the blob. Valid as built, the cases break one field each
+    struct TEST_PACK
+    {
+        FoxPack::PACK_HEADER Header{};
+        FoxPack::PACK_ENTRY  Entry {};
+        uint32_t             Buckets[2]{};
+
+        TEST_PACK()
+        {
+            std::memcpy(Header.Magic, FoxPack::FILE_MAGIC, sizeof(Header.Magic));
+            Header.Version       = FoxPack::FILE_VERSION;
+            Header.EntryCount    = 1;
+            Header.BucketCount   = 2;
+            Header.BlobAlignment = 1;
+            Header.NamesSize     = static_cast<uint32_t>(NAME.size());
+            Header.EntriesOffset = offsetof(TEST_PACK, Entry);
+            Header.BucketsOffset = offsetof(TEST_PACK, Buckets);
+            Header.NamesOffset   = sizeof(TEST_PACK);
+
+            Entry.Hash       = FoxPack::HashPath(NAME);
+            Entry.Offset     = sizeof(TEST_PACK) + NAME.size();
+            Entry.Size       = CONTENT.size();
+            Entry.NameOffset = 0;
+            Entry.NameLength = static_cast<uint32_t>(NAME.size());
+
+            Buckets[Entry.Hash & 1] = 1;
+        }
+    };
+
+    bool WritePack(const std::string& path, const TEST_PACK& pack)
+    {
+        FileSystem file;
+        if (!file.OpenForWrite(path)) return false;
+
+        const bool written = file.WriteBytes(&pack, sizeof(pack)) &&
+                             file.WriteBytes(NAME.data(), NAME.size()) &&
+                             file.WriteBytes(CONTENT.data(), CONTENT.size());
+        file.Close();
+        return written;
+    }
+
+    bool ExpectMount(const char* label, const TEST_PACK& pack, const bool expected)
+    {
+        const std::string path = "vfs_corrupt_test.fxpk";
+        if (!WritePack(path, pack))
+        {
+            std::printf("FAILED: %s: could not write %s\n", label, path.c_str());
+            return false;
+        }
+
+        const bool mounted = VirtualFileSystem::Mount(path);
+        const bool found   = mounted && VirtualFileSystem::IsPacked(NAME);
+        VirtualFileSystem::UnmountAll();
+        FileSystem::DeleteFiles(path);
+
+        if (mounted != expected || found != expected)
+        {
+            std::printf("FAILED: %s: mounted %d, expected %d\n", label, mounted, expected);
+            return false;
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    bool ok = ExpectMount("valid pack", TEST_PACK{}, true);
+
+    TEST_PACK entries{};
+    entries.Header.EntriesOffset = NEAR_END;
+    ok &= ExpectMount("entries offset wraps", entries, false);
+
+    TEST_PACK buckets{};
+    buckets.Header.BucketsOffset = NEAR_END;
+    ok &= ExpectMount("buckets offset wraps", buckets, false);
+
+    TEST_PACK names{};
+    names.Header.NamesOffset = ~uint64_t{ 0 } - 1;
+    ok &= ExpectMount("names offset wraps", names, false);
+
+    TEST_PACK blob{};
+    blob.Entry.Offset = ~uint64_t{ 0 } - 1;
+    blob.Entry.Size   = 16;
+    ok &= ExpectMount("blob range wraps", blob, false);
+
+    TEST_PACK truncated{};
+    truncated.Entry.Size = 4096;
+    ok &= ExpectMount("blob past the end", truncated, false);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,62 @@
+//
+// binlog-decoder: turns a .binlog written with LOGGER_INIT_DESC::EnableBinary back into text.
+// usage: binlog-decoder <file.binlog> [-o out.log] [--timestamps] [--threads]
+//
+
+#include "Logger/BinaryLogDecoder.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    std::string inputPath;
+    std::string outputPath;
+    BINLOG_DECODE_DESC desc{};
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if      (arg == "--timestamps")        desc.ShowTimestamps = true;
+        else if (arg == "--threads")           desc.ShowThreadIds  = true;
+        else if (arg == "-o" && i + 1 < argc)  outputPath = argv[++i];
+        else                                   inputPath  = arg;
+    }
+
+    if (inputPath.empty())
+    {
+        std::cerr << "usage: binlog-decoder <file.binlog> [-o out.log] [--timestamps] [--threads]\n";
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream input(inputPath, std::ios::binary);
+    if (!input)
+    {
+        std::cerr << "Failed to open " << inputPath << "\n";
+        return EXIT_FAILURE;
+    }
+    const std::string bytes{ std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>() };
+
+    BinaryLogDecoder decoder{ desc };
+    std::string text;
+    if (!decoder.Decode(bytes, text))
+    {
+        std::cerr << decoder.GetError() << "\n";
+        return EXIT_FAILURE;
+    }
+    if (!decoder.GetError().empty()) std::cerr << "warning: " << decoder.GetError() << "\n";
+
+    if (outputPath.empty())
+    {
+        std::fwrite(text.data(), 1, text.size(), stdout);
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream output(outputPath, std::ios::binary);
+    output.write(text.data(), static_cast<std::streamsize>(text.size()));
+    return output ? EXIT_SUCCESS : EXIT_FAILURE;
+}
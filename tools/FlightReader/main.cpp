@@ -0,0 +1,63 @@
+//
+// flight-reader: prints what the always-on FlightRecorder captured before a run ended.
+// usage: flight-reader <file.fxfr> [-o out.log] [--seconds N] [--sites] [--no-threads]
+//
+
+#include "Logger/FlightRecorderReader.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    std::string inputPath;
+    std::string outputPath;
+    FLIGHT_READ_DESC desc{};
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if      (arg == "--sites")                    desc.ShowCallSites = true;
+        else if (arg == "--no-threads")               desc.ShowThreadIds = false;
+        else if (arg == "--seconds" && i + 1 < argc)  desc.LastSeconds   = std::atof(argv[++i]);
+        else if (arg == "-o" && i + 1 < argc)         outputPath = argv[++i];
+        else                                          inputPath  = arg;
+    }
+
+    if (inputPath.empty())
+    {
+        std::cerr << "usage: flight-reader <file.fxfr> [-o out.log] [--seconds N] [--sites] [--no-threads]\n";
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream input(inputPath, std::ios::binary);
+    if (!input)
+    {
+        std::cerr << "Failed to open " << inputPath << "\n";
+        return EXIT_FAILURE;
+    }
+    const std::string bytes{ std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>() };
+
+    FlightRecorderReader reader{ desc };
+    std::string text;
+    if (!reader.Read(bytes, text))
+    {
+        std::cerr << reader.GetError() << "\n";
+        return EXIT_FAILURE;
+    }
+    if (!reader.GetError().empty()) std::cerr << "warning: " << reader.GetError() << "\n";
+
+    if (outputPath.empty())
+    {
+        std::fwrite(text.data(), 1, text.size(), stdout);
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream output(outputPath, std::ios::binary);
+    output.write(text.data(), static_cast<std::streamsize>(text.size()));
+    return output ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,202 @@
+//
+// fox-packer: bakes loose asset directories into one .fxpk for VirtualFileSystem.
+// usage: fox-packer -o out.fxpk <dir>[=mount] [<dir>[=mount] ...]
+//        files land under "<mount>/<relative path>", mount defaults to the directory name
+//
+
+#include "FileSystem/PackFormat.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    struct PACK_SOURCE
+    {
+        fs::path    Source;
+        std::string Name;   // normalized
+        uint64_t    Hash{ 0 };
+        uint64_t    Size{ 0 };
+    };
+
+    uint64_t AlignUp(const uint64_t value, const uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    std::string Normalize(const std::string_view path)
+    {
+        std::string out;
+        for (const char c : FoxPack::TrimPath(path)) out += FoxPack::NormalizeChar(c);
+        return out;
+    }
+
+    bool Collect(const std::string& argument, std::vector<PACK_SOURCE>& out)
+    {
+        const size_t split = argument.find('=');
+        const fs::path root = argument.substr(0, split);
+        std::string mount   = split == std::string::npos ? root.filename().string() : argument.substr(split + 1);
+
+        std::error_code ec;
+        if (!fs::is_directory(root, ec))
+        {
+            std::cerr << "Not a directory: " << root.string() << "\n";
+            return false;
+        }
+
+        for (const auto& item : fs::recursive_directory_iterator(root, ec))
+        {
+            if (!item.is_regular_file()) continue;
+
+            //~ build stamps written by copy_assets and CompileShaders are not assets
+            if (item.path().filename() == ".timestamp") continue;
+
+            const std::string relative = fs::relative(item.path(), root).generic_string();
+            PACK_SOURCE source{};
+            source.Source = item.path();
+            source.Name   = Normalize(mount.empty() ? relative : mount + "/" + relative);
+            source.Hash   = FoxPack::HashPath(source.Name);
+            source.Size   = item.file_size();
+            out.push_back(std::move(source));
+        }
+        if (ec)
+        {
+            std::cerr << "Failed to walk " << root.string() << ": " << ec.message() << "\n";
+            return false;
+        }
+        return true;
+    }
+
+    template<typename T>
+    void WriteAt(std::ofstream& out, const uint64_t offset, const T* data, const size_t count)
+    {
+        out.seekp(static_cast<std::streamoff>(offset));
+        out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(sizeof(T) * count));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::string outputPath;
+    std::vector<std::string> inputs;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) outputPath = argv[++i];
+        else                             inputs.push_back(arg);
+    }
+
+    if (outputPath.empty() || inputs.empty())
+    {
+        std::cerr << "usage: fox-packer -o out.fxpk <dir>[=mount] [<dir>[=mount] ...]\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<PACK_SOURCE> sources;
+    for (const std::string& input : inputs)
+    {
+        if (!Collect(input, sources)) return EXIT_FAILURE;
+    }
+
+    //~ sorted by hash so equal hashes sit together and the TOC is stable between builds
+    std::ranges::sort(sources, [](const PACK_SOURCE& a, const PACK_SOURCE& b)
+    {
+        return a.Hash != b.Hash ? a.Hash < b.Hash : a.Name < b.Name;
+    });
+    for (size_t i = 1; i < sources.size(); ++i)
+    {
+        if (sources[i].Name == sources[i - 1].Name)
+        {
+            std::cerr << "Duplicate pack path: " << sources[i].Name << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    const auto entryCount = static_cast<uint32_t>(sources.size());
+    uint32_t bucketCount = 16;
+    while (bucketCount < entryCount * 2) bucketCount <<= 1;
+
+    std::vector<FoxPack::PACK_ENTRY> entries(entryCount);
+    std::vector<uint32_t>            buckets(bucketCount, 0);
+    std::string                      names;
+
+    FoxPack::PACK_HEADER header{};
+    std::memcpy(header.Magic, FoxPack::FILE_MAGIC, sizeof(header.Magic));
+    header.Version       = FoxPack::FILE_VERSION;
+    header.EntryCount    = entryCount;
+    header.BucketCount   = bucketCount;
+    header.BlobAlignment = FoxPack::BLOB_ALIGNMENT;
+    header.EntriesOffset = AlignUp(sizeof(FoxPack::PACK_HEADER), alignof(FoxPack::PACK_ENTRY));
+    header.BucketsOffset = header.EntriesOffset + uint64_t{ entryCount } * sizeof(FoxPack::PACK_ENTRY);
+    header.NamesOffset   = header.BucketsOffset + uint64_t{ bucketCount } * sizeof(uint32_t);
+
+    for (const PACK_SOURCE& source : sources) names += source.Name;
+    header.NamesSize = static_cast<uint32_t>(names.size());
+
+    uint64_t cursor     = AlignUp(header.NamesOffset + header.NamesSize, FoxPack::BLOB_ALIGNMENT);
+    uint32_t nameCursor = 0;
+    for (uint32_t i = 0; i < entryCount; ++i)
+    {
+        FoxPack::PACK_ENTRY& entry = entries[i];
+        entry.Hash       = sources[i].Hash;
+        entry.Offset     = cursor;
+        entry.Size       = sources[i].Size;
+        entry.NameOffset = nameCursor;
+        entry.NameLength = static_cast<uint32_t>(sources[i].Name.size());
+        nameCursor += entry.NameLength;
+        cursor      = AlignUp(cursor + entry.Size, FoxPack::BLOB_ALIGNMENT);
+
+        uint32_t bucket = static_cast<uint32_t>(entry.Hash) & (bucketCount - 1);
+        while (buckets[bucket] != 0) bucket = (bucket + 1) & (bucketCount - 1);
+        buckets[bucket] = i + 1;
+    }
+
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        std::cerr << "Failed to open " << outputPath << "\n";
+        return EXIT_FAILURE;
+    }
+
+    WriteAt(out, 0,                    &header,         1);
+    WriteAt(out, header.EntriesOffset, entries.data(),  entries.size());
+    WriteAt(out, header.BucketsOffset, buckets.data(),  buckets.size());
+    WriteAt(out, header.NamesOffset,   names.data(),    names.size());
+
+    std::vector<char> blob;
+    for (uint32_t i = 0; i < entryCount; ++i)
+    {
+        std::ifstream input(sources[i].Source, std::ios::binary);
+        blob.resize(static_cast<size_t>(sources[i].Size));
+        if (!input.read(blob.data(), static_cast<std::streamsize>(blob.size())))
+        {
+            std::cerr << "Failed to read " << sources[i].Source.string() << "\n";
+            return EXIT_FAILURE;
+        }
+        WriteAt(out, entries[i].Offset, blob.data(), blob.size());
+    }
+
+    //~ pad the tail so the last blob is aligned like the rest, seekp alone does not grow the file
+    if (cursor > 0 && static_cast<uint64_t>(out.tellp()) < cursor)
+    {
+        out.seekp(static_cast<std::streamoff>(cursor - 1));
+        out.put('\0');
+    }
+
+    if (!out.flush())
+    {
+        std::cerr << "Failed to write " << outputPath << "\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Packed " << entryCount << " files into " << outputPath << " (" << cursor << " bytes)\n";
+    return EXIT_SUCCESS;
+}